@@ -190,9 +190,8 @@ DBusControlCenterGrandSearchService::~DBusControlCenterGrandSearchService()
 //匹配搜索结果
 QString DBusControlCenterGrandSearchService::Search(const QString json)
 {
-    QString val = parent()->GrandSearchSearch(json);
     m_autoExitTimer->start();
-    return val;
+    return parent()->GrandSearchSearch(json);
 }
 
 //停止搜索
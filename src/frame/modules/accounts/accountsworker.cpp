@@ -5,6 +5,7 @@
 #include "accountsworker.h"
 #include "window/utils.h"
 #include "widgets/utils.h"
+#include "modules/dbuspropertysnapshot.h"
 
 #include <QFileDialog>
 #include <QtConcurrent>
@@ -18,6 +19,7 @@
 #include <unistd.h>
 #include <libintl.h>
 #include <random>
+#include <memory>
 #include <crypt.h>
 #include <polkit-qt5-1/PolkitQt1/Authority>
 
@@ -36,7 +38,7 @@ const QString Secadm_u = "secadm_u";
 const QString Audadm_u = "audadm_u";
 const QString Auditadm_u = "auditadm_u";
 
-AccountsWorker::AccountsWorker(UserModel *userList, QObject *parent)
+AccountsWorker::AccountsWorker(UserModel *userList, QObject *parent, const AccountsPrefetch &prefetch)
     : QObject(parent)
     , m_accountsInter(new Accounts(AccountsService, "/com/deepin/daemon/Accounts", QDBusConnection::systemBus(), this))
     , m_syncHelperInter(new QDBusInterface("com.deepin.sync.Helper", "/com/deepin/sync/Helper", "com.deepin.sync.Helper", QDBusConnection::systemBus(), this))
@@ -55,7 +57,7 @@ AccountsWorker::AccountsWorker(UserModel *userList, QObject *parent)
     pws = getpwuid(getuid());
     m_currentUserName = QString(pws->pw_name);
     m_userModel->setCurrentUserName(m_currentUserName);
-    m_userModel->setIsSecurityHighLever(hasOpenSecurity());
+    m_userModel->setIsSecurityHighLever(prefetch.ready ? prefetch.securityHighLever : hasOpenSecurity());
 
     connect(m_accountsInter, &Accounts::UserListChanged, this, &AccountsWorker::onUserListChanged, Qt::QueuedConnection);
     connect(m_accountsInter, &Accounts::UserAdded, this, &AccountsWorker::addUser, Qt::QueuedConnection);
@@ -68,12 +70,18 @@ AccountsWorker::AccountsWorker(UserModel *userList, QObject *parent)
 #ifdef DCC_ENABLE_ADDOMAIN
     m_notifyInter->setSync(false);
 #endif
-    QDBusInterface interface(AccountsService, "/com/deepin/daemon/Accounts", AccountsService, QDBusConnection::systemBus());
-    QList<QVariant> currentUserPath = interface.call("FindUserById", QString::number(pws->pw_uid)).arguments();
-    if (!currentUserPath.isEmpty()) {
-        onUserListChanged({currentUserPath.first().toString()});
+    if (prefetch.ready) {
+        if (!prefetch.currentUserPath.isEmpty())
+            onUserListChanged({prefetch.currentUserPath});
+        onUserListChanged(prefetch.userList);
+    } else {
+        QDBusInterface interface(AccountsService, "/com/deepin/daemon/Accounts", AccountsService, QDBusConnection::systemBus());
+        QList<QVariant> currentUserPath = interface.call("FindUserById", QString::number(pws->pw_uid)).arguments();
+        if (!currentUserPath.isEmpty()) {
+            onUserListChanged({currentUserPath.first().toString()});
+        }
+        onUserListChanged(interface.property("UserList").toStringList());
     }
-    onUserListChanged(interface.property("UserList").toStringList());
     updateUserOnlineStatus(m_dmInter->sessions());
     getAllGroups();
     getPresetGroups();
@@ -101,6 +109,57 @@ AccountsWorker::AccountsWorker(UserModel *userList, QObject *parent)
     getLogin1SessionSelf();
 }
 
+void AccountsWorker::prefetch(QObject *context, std::function<void(const AccountsPrefetch &)> done)
+{
+    // 与同步获取的处理一致，请求失败时按空结果处理
+    auto data = std::make_shared<AccountsPrefetch>();
+    auto pending = std::make_shared<int>(3);
+    auto finish = [data, pending, done] {
+        if (--*pending > 0)
+            return;
+
+        data->ready = true;
+        done(*data);
+    };
+
+    QDBusMessage statusMsg = QDBusMessage::createMethodCall("com.deepin.daemon.SecurityEnhance",
+                                                            "/com/deepin/daemon/SecurityEnhance",
+                                                            "com.deepin.daemon.SecurityEnhance", "Status");
+    QDBusPendingCallWatcher *statusWatcher = new QDBusPendingCallWatcher(QDBusConnection::systemBus().asyncCall(statusMsg), context);
+    connect(statusWatcher, &QDBusPendingCallWatcher::finished, context, [data, statusWatcher, finish] {
+        QDBusPendingReply<QString> reply = *statusWatcher;
+        if (reply.isError())
+            qDebug() << reply.error().message();
+        else
+            data->securityHighLever = reply.value() == "open";
+        statusWatcher->deleteLater();
+        finish();
+    });
+
+    QDBusMessage findMsg = QDBusMessage::createMethodCall(AccountsService, "/com/deepin/daemon/Accounts", AccountsService, "FindUserById");
+    findMsg << QString::number(getuid());
+    QDBusPendingCallWatcher *findWatcher = new QDBusPendingCallWatcher(QDBusConnection::systemBus().asyncCall(findMsg), context);
+    connect(findWatcher, &QDBusPendingCallWatcher::finished, context, [data, findWatcher, finish] {
+        QDBusPendingReply<QString> reply = *findWatcher;
+        if (!reply.isError())
+            data->currentUserPath = reply.value();
+        findWatcher->deleteLater();
+        finish();
+    });
+
+    DBusPropertySnapshot *snapshot = new DBusPropertySnapshot(AccountsService, "/com/deepin/daemon/Accounts", AccountsService, QDBusConnection::systemBus(), context);
+    connect(snapshot, &DBusPropertySnapshot::ready, context, [data, snapshot, finish] {
+        data->userList = snapshot->value<QStringList>("UserList");
+        snapshot->deleteLater();
+        finish();
+    });
+    connect(snapshot, &DBusPropertySnapshot::failed, context, [snapshot, finish] {
+        snapshot->deleteLater();
+        finish();
+    });
+    snapshot->fetch();
+}
+
 void AccountsWorker::getAllGroups()
 {
     QDBusPendingReply<QStringList> reply = m_accountsInter->GetGroups();
@@ -599,7 +658,7 @@ void AccountsWorker::addUser(const QString &userPath)
 
     User *user = new User(this);
 
-    connect(userInter, &AccountsUser::UserNameChanged, user, [=](const QString &name) {
+    auto setUserName = [=](const QString &name) {
         user->setName(name);
         user->setSecurityLever(getSecUserLeverbyname(name));
         user->setOnline(m_onlineUsers.contains(name));
@@ -607,8 +666,9 @@ void AccountsWorker::addUser(const QString &userPath)
 #ifdef DCC_ENABLE_ADDOMAIN
         checkADUser();
 #endif
-    });
+    };
 
+    connect(userInter, &AccountsUser::UserNameChanged, user, setUserName);
     connect(userInter, &AccountsUser::AutomaticLoginChanged, user, &User::setAutoLogin);
     connect(userInter, &AccountsUser::IconListChanged, user, &User::setAvatars);
     connect(userInter, &AccountsUser::IconFileChanged, user, &User::setCurrentAvatar);
@@ -624,19 +684,26 @@ void AccountsWorker::addUser(const QString &userPath)
     // 这里直接赋值的话, 由于请求是异步的, 所以一开始会被初始化成乱码,
     // 然后数据正常了以后会额外产生一次变化信号
     // 对于计算当前有多少个管理员有干扰.
-    userInter->userName();
-    userInter->fullName();
-    userInter->automaticLogin();
-    userInter->iconList();
-    userInter->groups();
-    userInter->iconFile();
-    userInter->noPasswdLogin();
-    userInter->passwordStatus();
-    userInter->createdTime();
-    userInter->accountType();
-    userInter->maxPasswordAge();
+    // 所以用一次 GetAll 取回全部属性, 结果返回后一次性填入
+    DBusPropertySnapshot *snapshot = new DBusPropertySnapshot(userInter, userInter);
+    connect(snapshot, &DBusPropertySnapshot::ready, user, [=] {
+        setUserName(snapshot->value<QString>("UserName"));
+        user->setFullname(snapshot->value<QString>("FullName"));
+        user->setAutoLogin(snapshot->value<bool>("AutomaticLogin"));
+        user->setAvatars(snapshot->value<QStringList>("IconList"));
+        user->setGroups(snapshot->value<QStringList>("Groups"));
+        user->setCurrentAvatar(snapshot->value<QString>("IconFile"));
+        user->setNopasswdLogin(snapshot->value<bool>("NoPasswdLogin"));
+        user->setPasswordStatus(snapshot->value<QString>("PasswordStatus"));
+        user->setCreatedTime(snapshot->value<quint64>("CreatedTime"));
+        user->setUserType(snapshot->value<int>("AccountType"));
+        user->setPasswordAge(snapshot->value<int>("MaxPasswordAge"));
+        user->setGid(snapshot->value<QString>("Gid"));
+        snapshot->deleteLater();
+    });
+    connect(snapshot, &DBusPropertySnapshot::failed, snapshot, &DBusPropertySnapshot::deleteLater);
+    snapshot->fetch();
     userInter->IsPasswordExpired();
-    userInter->gid();
 
     m_userInters[user] = userInter;
     m_userModel->addUser(userPath, user);
@@ -20,6 +20,8 @@
 #include "usermodel.h"
 #include "creationresult.h"
 
+#include <functional>
+
 using Accounts = com::deepin::daemon::Accounts;
 using AccountsUser = com::deepin::daemon::accounts::User;
 using CreationResult = dcc::accounts::CreationResult;
@@ -45,12 +47,25 @@ struct BindCheckResult {
 
 typedef QMap<int, QByteArray> SecurityQuestions;
 
+// 预初始化前异步取回的账户数据，构造 worker 时代替主线程上的同步请求
+struct AccountsPrefetch
+{
+    bool ready = false;
+    bool securityHighLever = false;
+    QString currentUserPath;
+    QStringList userList;
+};
+
 class AccountsWorker : public QObject
 {
     Q_OBJECT
 
 public:
-    explicit AccountsWorker(UserModel * userList, QObject *parent = 0);
+    // prefetch 未就绪时同步获取
+    explicit AccountsWorker(UserModel * userList, QObject *parent = 0, const AccountsPrefetch &prefetch = AccountsPrefetch());
+
+    // 异步获取构造 worker 所需的数据，全部返回后调用 done，context 销毁后不再回调
+    static void prefetch(QObject *context, std::function<void(const AccountsPrefetch &)> done);
 
     void active();
     QString getCurrentUserName();
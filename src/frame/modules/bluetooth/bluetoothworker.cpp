@@ -3,22 +3,30 @@
 // SPDX-License-Identifier: LGPL-3.0-or-later
 
 #include "bluetoothworker.h"
+#include "modules/dbuspropertysnapshot.h"
 
 #include <QJsonDocument>
 #include <QJsonObject>
 #include <QJsonArray>
 #include <QTimer>
 
+#include <memory>
+
 namespace dcc {
 namespace bluetooth {
 
-BluetoothWorker::BluetoothWorker(BluetoothModel *model, bool sync)
+const QString BluetoothService("com.deepin.daemon.Bluetooth");
+const QString BluetoothPath("/com/deepin/daemon/Bluetooth");
+const QString AirplaneModeService("com.deepin.daemon.AirplaneMode");
+const QString AirplaneModePath("/com/deepin/daemon/AirplaneMode");
+
+BluetoothWorker::BluetoothWorker(BluetoothModel *model, bool sync, const BluetoothPrefetch &prefetch)
     : QObject()
     , m_bluetoothInter(new DBusBluetooth("com.deepin.daemon.Bluetooth", "/com/deepin/daemon/Bluetooth", QDBusConnection::sessionBus(), this))
     , m_airPlaneModeInter(new DBusAirplaneMode("com.deepin.daemon.AirplaneMode", "/com/deepin/daemon/AirplaneMode", QDBusConnection::systemBus(), this))
     , m_model(model)
     , m_connectingAudioDevice(false)
-    , m_state(m_bluetoothInter->state())
+    , m_state(prefetch.ready ? prefetch.bluetoothProperties.value("State").toUInt() : m_bluetoothInter->state())
     , m_powerSwitchTimer(new QTimer(this))
 {
     m_powerSwitchTimer->setSingleShot(true);
@@ -105,11 +113,24 @@ BluetoothWorker::BluetoothWorker(BluetoothModel *model, bool sync)
                                           this, SLOT(handleDbusSignal(QDBusMessage)));
 #endif
 
+    connect(m_airPlaneModeInter, &DBusAirplaneMode::EnabledChanged, m_model, &BluetoothModel::setAirplaneEnable);
+
+    // 数据已由 prefetch 异步取回时直接使用，不再在主线程上同步请求
+    if (prefetch.ready) {
+        m_model->setTransportable(prefetch.bluetoothProperties.value("Transportable").toBool());
+        m_model->setCanSendFile(prefetch.bluetoothProperties.value("CanSendFile").toBool());
+        m_model->setDisplaySwitch(prefetch.bluetoothProperties.value("DisplaySwitch").toBool());
+        m_model->setAirplaneEnable(prefetch.airplaneEnabled);
+        addAdapters(prefetch.adapters);
+
+        m_bluetoothInter->setSync(false);
+        m_airPlaneModeInter->setSync(sync);
+        return;
+    }
+
     m_model->setTransportable(m_bluetoothInter->transportable());
     m_model->setCanSendFile(m_bluetoothInter->canSendFile());
     m_model->setDisplaySwitch(m_bluetoothInter->displaySwitch());
-
-    connect(m_airPlaneModeInter, &DBusAirplaneMode::EnabledChanged, m_model, &BluetoothModel::setAirplaneEnable);
     m_model->setAirplaneEnable(m_airPlaneModeInter->enabled());
 
     m_bluetoothInter->setSync(sync);
@@ -138,12 +159,64 @@ void BluetoothWorker::onStateChanged(uint state)
     m_state = state;
 }
 
-BluetoothWorker &BluetoothWorker::Instance(bool sync)
+BluetoothWorker &BluetoothWorker::Instance(bool sync, const BluetoothPrefetch &prefetch)
 {
-    static BluetoothWorker worker(new BluetoothModel, sync);
+    static BluetoothWorker worker(new BluetoothModel, sync, prefetch);
     return worker;
 }
 
+void BluetoothWorker::prefetch(QObject *context, std::function<void(const BluetoothPrefetch &)> done)
+{
+    // 三个请求同时发出，任一失败时 ready 为 false，由构造函数回退到同步获取
+    auto data = std::make_shared<BluetoothPrefetch>();
+    auto pending = std::make_shared<int>(3);
+    data->ready = true;
+    auto finish = [data, pending, done](bool ok) {
+        data->ready = data->ready && ok;
+        if (--*pending == 0)
+            done(*data);
+    };
+
+    DBusPropertySnapshot *bluetooth = new DBusPropertySnapshot(BluetoothService, BluetoothPath, BluetoothService, QDBusConnection::sessionBus(), context);
+    connect(bluetooth, &DBusPropertySnapshot::ready, context, [data, bluetooth, finish] {
+        data->bluetoothProperties = bluetooth->properties();
+        bluetooth->deleteLater();
+        finish(true);
+    });
+    connect(bluetooth, &DBusPropertySnapshot::failed, context, [bluetooth, finish] {
+        bluetooth->deleteLater();
+        finish(false);
+    });
+    bluetooth->fetch();
+
+    DBusPropertySnapshot *airplane = new DBusPropertySnapshot(AirplaneModeService, AirplaneModePath, AirplaneModeService, QDBusConnection::systemBus(), context);
+    connect(airplane, &DBusPropertySnapshot::ready, context, [data, airplane, finish] {
+        data->airplaneEnabled = airplane->value<bool>("Enabled");
+        airplane->deleteLater();
+        finish(true);
+    });
+    connect(airplane, &DBusPropertySnapshot::failed, context, [airplane, finish] {
+        airplane->deleteLater();
+        finish(false);
+    });
+    airplane->fetch();
+
+    QDBusMessage msg = QDBusMessage::createMethodCall(BluetoothService, BluetoothPath, BluetoothService, "GetAdapters");
+    QDBusPendingCallWatcher *watcher = new QDBusPendingCallWatcher(QDBusConnection::sessionBus().asyncCall(msg), context);
+    connect(watcher, &QDBusPendingCallWatcher::finished, context, [data, watcher, finish] {
+        QDBusPendingReply<QString> reply = *watcher;
+        watcher->deleteLater();
+        if (reply.isError()) {
+            qWarning() << "GetAdapters failed:" << reply.error().message();
+            finish(false);
+            return;
+        }
+
+        data->adapters = reply.value();
+        finish(true);
+    });
+}
+
 void BluetoothWorker::activate()
 {
     if (!m_bluetoothInter->isValid()) {
@@ -437,15 +510,7 @@ void BluetoothWorker::refresh(bool beFirst)
     if (!m_bluetoothInter->isValid()) return;
 
     auto resol = [this](const QDBusReply<QString> &req){
-        const QString replyStr = req.value();
-        QJsonDocument doc = QJsonDocument::fromJson(replyStr.toUtf8());
-        QJsonArray arr = doc.array();
-        for (QJsonValue val : arr) {
-            Adapter *adapter = new Adapter(m_model);
-            inflateAdapter(adapter, val.toObject());
-
-            m_model->addAdapter(adapter);
-        }
+        addAdapters(req.value());
     };
 
     if (beFirst) {
@@ -471,6 +536,18 @@ void BluetoothWorker::refresh(bool beFirst)
     });
 }
 
+void BluetoothWorker::addAdapters(const QString &json)
+{
+    QJsonDocument doc = QJsonDocument::fromJson(json.toUtf8());
+    QJsonArray arr = doc.array();
+    for (QJsonValue val : arr) {
+        Adapter *adapter = new Adapter(m_model);
+        inflateAdapter(adapter, val.toObject());
+
+        m_model->addAdapter(adapter);
+    }
+}
+
 void BluetoothWorker::setAlias(const Adapter *adapter, const QString &alias)
 {
     m_bluetoothInter->SetAdapterAlias(QDBusObjectPath(adapter->id()), alias);
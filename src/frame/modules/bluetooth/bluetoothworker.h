@@ -6,6 +6,7 @@
 #define DCC_BLUETOOTH_BLUETOOTHWORKER_H
 
 #include <QObject>
+#include <QVariantMap>
 
 #include <com_deepin_daemon_bluetooth.h>
 #include <com_deepin_daemon_airplanemode.h>
@@ -13,17 +14,31 @@
 #include "bluetoothmodel.h"
 #include "pincodedialog.h"
 
+#include <functional>
+
 using DBusBluetooth = com::deepin::daemon::Bluetooth;
 using DBusAirplaneMode = com::deepin::daemon::AirplaneMode;
 
 namespace dcc {
 namespace bluetooth {
 
+// 预初始化前异步取回的蓝牙服务数据，构造 worker 时代替主线程上的同步请求
+struct BluetoothPrefetch
+{
+    bool ready = false;
+    QVariantMap bluetoothProperties;
+    bool airplaneEnabled = false;
+    QString adapters;
+};
+
 class BluetoothWorker : public QObject
 {
     Q_OBJECT
 public:
-    static BluetoothWorker &Instance(bool sync = false);
+    // prefetch 只在首次调用、创建 worker 时使用，未就绪时同步获取
+    static BluetoothWorker &Instance(bool sync = false, const BluetoothPrefetch &prefetch = BluetoothPrefetch());
+    // 异步获取构造 worker 所需的数据，全部返回后调用 done，context 销毁后不再回调
+    static void prefetch(QObject *context, std::function<void(const BluetoothPrefetch &)> done);
 
     BluetoothModel *model() { return m_model; }
 
@@ -53,6 +68,7 @@ public Q_SLOTS:
     void handleDbusSignal(QDBusMessage mes);
 
 private:
+    void addAdapters(const QString &json);
     void inflateAdapter(Adapter *adapter, const QJsonObject &adapterObj);
     void inflateDevice(Device *device, const QJsonObject &deviceObj);
 
@@ -70,7 +86,7 @@ private Q_SLOTS:
     void onStateChanged(uint state);
 
 private:
-    explicit BluetoothWorker(BluetoothModel *model, bool sync = false);
+    explicit BluetoothWorker(BluetoothModel *model, bool sync = false, const BluetoothPrefetch &prefetch = BluetoothPrefetch());
     BluetoothWorker(BluetoothWorker const &) = delete;
     BluetoothWorker& operator =(BluetoothWorker const &) = delete;
     ~BluetoothWorker();
@@ -0,0 +1,108 @@
+// SPDX-FileCopyrightText: 2022 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include "coalescingsetter.h"
+
+#include <QDateTime>
+#include <QDBusPendingCallWatcher>
+#include <QDebug>
+
+using namespace dcc;
+
+CoalescingSetter::CoalescingSetter(Sender sender, QObject *parent)
+    : QObject(parent)
+    , m_sender(std::move(sender))
+    , m_inFlight(nullptr)
+    , m_pendingSince(0)
+{
+}
+
+CoalescingSetter::~CoalescingSetter()
+{
+    reportStatistics();
+}
+
+void CoalescingSetter::set(const QVariant &value)
+{
+    ++m_statistics.requested;
+
+    if (m_pending.isValid()) {
+        ++m_statistics.coalesced;
+    } else {
+        m_pendingSince = QDateTime::currentMSecsSinceEpoch();
+    }
+    m_pending = value;
+
+    if (!m_inFlight)
+        send();
+}
+
+void CoalescingSetter::reset()
+{
+    m_pending = QVariant();
+    reportStatistics();
+}
+
+void CoalescingSetter::reportStatistics()
+{
+    if (m_statistics.requested == 0)
+        return;
+
+    qDebug() << objectName() << "setter statistics:" << m_statistics;
+    m_statistics = Statistics();
+}
+
+void CoalescingSetter::send()
+{
+    const QVariant value = m_pending;
+    m_pending = QVariant();
+
+    const int waited = static_cast<int>(QDateTime::currentMSecsSinceEpoch() - m_pendingSince);
+    m_statistics.maxWaitingMs = qMax(m_statistics.maxWaitingMs, waited);
+    ++m_statistics.sent;
+
+    m_inFlightValue = value;
+    m_inFlight = new QDBusPendingCallWatcher(m_sender(value), this);
+    connect(m_inFlight, &QDBusPendingCallWatcher::finished, this, &CoalescingSetter::onCallFinished);
+}
+
+void CoalescingSetter::onCallFinished(QDBusPendingCallWatcher *watcher)
+{
+    m_inFlight = nullptr;
+    watcher->deleteLater();
+
+    if (watcher->isError()) {
+        ++m_statistics.failed;
+        qWarning() << objectName() << "set" << m_inFlightValue << "failed:" << watcher->error().message();
+        Q_EMIT failed(m_inFlightValue, watcher->error());
+    } else {
+        Q_EMIT applied(m_inFlightValue);
+    }
+
+    // 滑块的 valueChanged 和 sliderMoved 会带着相同的值先后到达，刚设置成功的值不再重复发出；
+    // 只与在途的值比较，空闲后值可能已被其他途径修改，相同的值仍需发出
+    if (m_pending.isValid() && !watcher->isError() && m_pending == m_inFlightValue) {
+        ++m_statistics.skipped;
+        m_pending = QVariant();
+    }
+
+    if (m_pending.isValid()) {
+        send();
+        return;
+    }
+
+    Q_EMIT idle();
+}
+
+QDebug dcc::operator<<(QDebug debug, const CoalescingSetter::Statistics &statistics)
+{
+    QDebugStateSaver saver(debug);
+    debug.nospace() << "requested " << statistics.requested
+                    << ", sent " << statistics.sent
+                    << ", coalesced " << statistics.coalesced
+                    << ", skipped " << statistics.skipped
+                    << ", failed " << statistics.failed
+                    << ", max waiting " << statistics.maxWaitingMs << "ms";
+    return debug;
+}
@@ -0,0 +1,75 @@
+// SPDX-FileCopyrightText: 2022 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#ifndef COALESCINGSETTER_H
+#define COALESCINGSETTER_H
+
+#include <QDBusError>
+#include <QDBusPendingCall>
+#include <QDebug>
+#include <QObject>
+#include <QVariant>
+
+#include <functional>
+
+class QDBusPendingCallWatcher;
+
+namespace dcc {
+
+// 合并连续设置请求的 D-Bus 设置器，以最后一次的值为准
+// 同一时刻最多只有一个调用在途；在途期间的新值只保留最后一个，调用返回后再发出，
+// 拖动滑块时不会向后端堆积请求，且最终值一定会被设置
+class CoalescingSetter : public QObject
+{
+    Q_OBJECT
+
+public:
+    using Sender = std::function<QDBusPendingCall(const QVariant &value)>;
+
+    // 背压统计
+    struct Statistics {
+        quint64 requested = 0;  // set 被调用的次数
+        quint64 sent = 0;       // 实际发出的 D-Bus 调用
+        quint64 coalesced = 0;  // 被后来的值覆盖而丢弃的请求
+        quint64 skipped = 0;    // 与刚设置成功的值相同而省略的请求
+        quint64 failed = 0;     // 返回错误的调用
+        int maxWaitingMs = 0;   // 请求从 set 到发出的最长等待时间
+    };
+
+    explicit CoalescingSetter(Sender sender, QObject *parent = nullptr);
+    ~CoalescingSetter();
+
+    void set(const QVariant &value);
+    // 丢弃未发出的值，用于设置目标发生变化时；同时输出并清空当前目标的统计
+    void reset();
+    // 输出统计并清空，没有请求时不输出
+    void reportStatistics();
+
+    bool isBusy() const { return m_inFlight != nullptr; }
+    const Statistics &statistics() const { return m_statistics; }
+
+Q_SIGNALS:
+    void applied(const QVariant &value);
+    void failed(const QVariant &value, const QDBusError &error);
+    // 在途调用返回且没有等待中的值
+    void idle();
+
+private:
+    void send();
+    void onCallFinished(QDBusPendingCallWatcher *watcher);
+
+private:
+    Sender m_sender;
+    QDBusPendingCallWatcher *m_inFlight;
+    QVariant m_inFlightValue;
+    QVariant m_pending;
+    qint64 m_pendingSince;
+    Statistics m_statistics;
+};
+
+QDebug operator<<(QDebug debug, const CoalescingSetter::Statistics &statistics);
+
+}
+
+#endif // COALESCINGSETTER_H
@@ -0,0 +1,79 @@
+// SPDX-FileCopyrightText: 2022 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include "clockticker.h"
+
+#include <QCoreApplication>
+#include <QMetaMethod>
+#include <QTimer>
+
+using namespace dcc::datetime;
+
+ClockTicker *ClockTicker::instance()
+{
+    // 随应用对象析构，定时器在事件循环仍有效时停止，不留到静态析构阶段
+    static ClockTicker *ticker = new ClockTicker(QCoreApplication::instance());
+    return ticker;
+}
+
+ClockTicker::ClockTicker(QObject *parent)
+    : QObject(parent)
+    , m_timer(new QTimer(this))
+{
+    // 每次只等到下一个整秒，避免累计误差使秒针与系统时间错开
+    m_timer->setSingleShot(true);
+    m_timer->setTimerType(Qt::PreciseTimer);
+    connect(m_timer, &QTimer::timeout, this, &ClockTicker::onTimeout);
+}
+
+void ClockTicker::connectNotify(const QMetaMethod &signal)
+{
+    Q_UNUSED(signal)
+    // 可能在其他线程中连接，定时器只在所属线程中操作
+    QMetaObject::invokeMethod(this, [this] { updateTimer(); }, Qt::QueuedConnection);
+}
+
+void ClockTicker::disconnectNotify(const QMetaMethod &signal)
+{
+    Q_UNUSED(signal)
+    QMetaObject::invokeMethod(this, [this] { updateTimer(); }, Qt::QueuedConnection);
+}
+
+void ClockTicker::updateTimer()
+{
+    const bool subscribed = isSignalConnected(QMetaMethod::fromSignal(&ClockTicker::secondChanged))
+                            || isSignalConnected(QMetaMethod::fromSignal(&ClockTicker::minuteChanged));
+    if (!subscribed) {
+        m_timer->stop();
+        return;
+    }
+
+    if (!m_timer->isActive()) {
+        m_lastTick = QDateTime::currentDateTime();
+        scheduleNextTick();
+    }
+}
+
+void ClockTicker::scheduleNextTick()
+{
+    const int msec = QTime::currentTime().msec();
+    m_timer->start(1000 - msec);
+}
+
+void ClockTicker::onTimeout()
+{
+    const QDateTime &now = QDateTime::currentDateTime();
+    scheduleNextTick();
+
+    // 定时器提前触发时仍在上一秒内，等到下一次再发出
+    if (now.toSecsSinceEpoch() == m_lastTick.toSecsSinceEpoch())
+        return;
+
+    const bool newMinute = now.toSecsSinceEpoch() / 60 != m_lastTick.toSecsSinceEpoch() / 60;
+    m_lastTick = now;
+
+    Q_EMIT secondChanged(now);
+    if (newMinute)
+        Q_EMIT minuteChanged(now);
+}
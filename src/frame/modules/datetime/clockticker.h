@@ -0,0 +1,47 @@
+// SPDX-FileCopyrightText: 2022 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#ifndef CLOCKTICKER_H
+#define CLOCKTICKER_H
+
+#include <QDateTime>
+#include <QObject>
+
+class QTimer;
+
+namespace dcc {
+namespace datetime {
+
+// 进程内共享的时钟节拍，在整秒处发出信号
+// 所有时钟控件订阅同一个定时器，没有连接时定时器停止
+class ClockTicker : public QObject
+{
+    Q_OBJECT
+public:
+    static ClockTicker *instance();
+
+Q_SIGNALS:
+    void secondChanged(const QDateTime &now);
+    void minuteChanged(const QDateTime &now);
+
+protected:
+    void connectNotify(const QMetaMethod &signal) override;
+    void disconnectNotify(const QMetaMethod &signal) override;
+
+private:
+    explicit ClockTicker(QObject *parent = nullptr);
+
+    void updateTimer();
+    void scheduleNextTick();
+    void onTimeout();
+
+private:
+    QTimer *m_timer;
+    QDateTime m_lastTick;
+};
+
+}
+}
+
+#endif // CLOCKTICKER_H
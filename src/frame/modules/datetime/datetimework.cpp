@@ -21,7 +21,7 @@ DatetimeWork::DatetimeWork(DatetimeModel *model, QObject *parent)
     , m_model(model)
     , m_timedateInter(new Timedate("com.deepin.daemon.Timedate", "/com/deepin/daemon/Timedate", QDBusConnection::sessionBus(), this))
     , m_systemtimedatedInter(new Timedated("com.deepin.daemon.Timedated", "/com/deepin/daemon/Timedated", QDBusConnection::systemBus(), this))
-    , m_appearanceInter(new Appearance(Appearance::staticInterfaceName(), "/com/deepin/daemon/Appearance", QDBusConnection::sessionBus(), this))
+    , m_appearanceInter(DBusProxyRegistry::get<Appearance>(Appearance::staticInterfaceName(), "/com/deepin/daemon/Appearance", QDBusConnection::sessionBus()))
 {
     m_timedateInter->setSync(false);
 
@@ -96,7 +96,7 @@ DatetimeWork::DatetimeWork(DatetimeModel *model, QObject *parent)
     m_model->setDigitGroupingSymbol(static_cast<QString>(formatInter.property("DigitGroupingSymbol").toString()));
     m_model->setNegativeCurrencyFormat(static_cast<QString>(formatInter.property("NegativeCurrencyFormat").toString()));
     m_model->setPositiveCurrencyFormat(static_cast<QString>(formatInter.property("PositiveCurrencyFormat").toString()));
-    m_model->setSystemActiveColor(m_appearanceInter->qtActiveColor());
+    m_model->setSystemActiveColor(DBusProxyRegistry::syncRead(m_appearanceInter.get(), &Appearance::qtActiveColor));
 
     //关联属性信号变化
     QDBusConnection::sessionBus().connect("com.deepin.daemon.Format",
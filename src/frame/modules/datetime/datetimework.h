@@ -6,6 +6,7 @@
 #define DATETIMEWORK_H
 
 #include "datetimemodel.h"
+#include "modules/dbusproxyregistry.h"
 
 #include <com_deepin_daemon_timedate.h>
 #include <com_deepin_daemon_timedated.h>
@@ -68,7 +69,7 @@ private:
     Timedate *m_timedateInter;
     Timedated *m_systemtimedatedInter;
     QStringList m_formatList;
-    Appearance *m_appearanceInter;
+    SharedDBusProxy<Appearance> m_appearanceInter;
 };
 }
 }
@@ -4,17 +4,11 @@
 
 #include "timezone.h"
 
-#ifndef _GNU_SOURCE
-#define _GNU_SOURCE  /* For tm_gmtoff and tm_zone */
-#endif
 #include <cmath>
-#include <libintl.h>
-#include <locale.h>
-#include <time.h>
 #include <QDebug>
 
-#include "consts.h"
 #include "file_util.h"
+#include "timezone_localizer.h"
 
 namespace installer {
 
@@ -26,9 +20,6 @@ const char kZoneTabFile[] = "/usr/share/zoneinfo/zone1970.tab";
 // Absolute path to backward timezone file.
 const char kTimezoneAliasFile[] = "/timezone_alias";
 
-// Domain name for timezones.
-const char kTimezoneDomain[] = "deepin-installer-timezones";
-
 // Parse latitude and longitude of the zone's principal location.
 // See https://en.wikipedia.org/wiki/List_of_tz_database_time_zones.
 // |pos| is in ISO 6709 sign-degrees-minutes-seconds format,
@@ -91,29 +82,6 @@ ZoneInfoList GetZoneInfoList() {
   return list;
 }
 
-int GetZoneInfoByCountry(const ZoneInfoList& list,
-                         const QString& country) {
-  int index = -1;
-  for (const ZoneInfo& info : list) {
-    index ++;
-    if (info.country == country) {
-      return index;
-    }
-  }
-  return -1;
-}
-
-int GetZoneInfoByZone(const ZoneInfoList& list, const QString& timezone) {
-  int index = -1;
-  for (const ZoneInfo& info : list) {
-    index ++;
-    if (info.timezone == timezone) {
-      return index;
-    }
-  }
-  return -1;
-}
-
 QString GetCurrentTimezone() {
   const QString content(ReadFile("/etc/timezone"));
   return content.trimmed();
@@ -125,20 +93,7 @@ QString GetTimezoneName(const QString& timezone) {
 }
 
 QString GetLocalTimezoneName(const QString& timezone, const QString& locale) {
-  // Set locale first.
-  (void) setlocale(LC_ALL, QString(locale + ".UTF-8").toStdString().c_str());
-  const QString local_name(dgettext(kTimezoneDomain,
-                                    timezone.toStdString().c_str()));
-  int index = local_name.lastIndexOf('/');
-  if (index == -1) {
-    // Some translations of locale name contains non-standard char.
-    index = local_name.lastIndexOf("∕");
-  }
-
-  // Reset locale.
-  (void) setlocale(LC_ALL, kDefaultLocale);
-
-  return (index > -1) ? local_name.mid(index + 1) : local_name;
+  return TimezoneLocalizer::instance().localName(timezone, locale);
 }
 
 TimezoneAliasMap GetTimezoneAliasMap() {
@@ -170,25 +125,7 @@ bool IsValidTimezone(const QString& timezone) {
 }
 
 TimezoneOffset GetTimezoneOffset(const QString& timezone) {
-  const char* kTzEnv = "TZ";
-  const char* old_tz = getenv(kTzEnv);
-  setenv(kTzEnv, timezone.toStdString().c_str(), 1);
-  struct tm tm;
-  const time_t curr_time = time(nullptr);
-
-  // Call tzset() before localtime_r(). Set tzset(3).
-  tzset();
-  (void) localtime_r(&curr_time, &tm);
-
-  // Reset timezone.
-  if (old_tz) {
-    setenv(kTzEnv, old_tz, 1);
-  } else {
-    unsetenv(kTzEnv);
-  }
-
-  const TimezoneOffset offset = {tm.tm_zone, tm.tm_gmtoff};
-  return offset;
+  return TimezoneLocalizer::instance().offset(timezone);
 }
 
 }  // namespace installer
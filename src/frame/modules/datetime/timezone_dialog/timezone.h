@@ -27,13 +27,9 @@ QDebug& operator<<(QDebug& debug, const ZoneInfo& info);
 typedef QList<ZoneInfo> ZoneInfoList;
 
 // Read available timezone info in zone.tab file.
+// Use TimezoneDatabase::instance() instead of reading the file again.
 ZoneInfoList GetZoneInfoList();
 
-// Find ZoneInfo based on |country| or |timezone|.
-// Returns -1 if not found.
-int GetZoneInfoByCountry(const ZoneInfoList& list, const QString& country);
-int GetZoneInfoByZone(const ZoneInfoList& list, const QString& timezone);
-
 // Read current timezone in /etc/timezone file.
 QString GetCurrentTimezone();
 
@@ -42,6 +38,7 @@ QString GetTimezoneName(const QString& timezone);
 
 // Returns local name of timezone, excluding continent name.
 // |locale| is desired locale name.
+// Thread-safe, see TimezoneLocalizer.
 QString GetLocalTimezoneName(const QString& timezone, const QString& locale);
 
 // A map between old name of timezone and current name.
@@ -58,6 +55,7 @@ struct TimezoneOffset {
 };
 
 // Get |timezone| GMT offset.
+// Thread-safe, see TimezoneLocalizer.
 TimezoneOffset GetTimezoneOffset(const QString& timezone);
 
 }  // namespace installer
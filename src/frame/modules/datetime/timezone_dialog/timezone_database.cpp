@@ -0,0 +1,168 @@
+// SPDX-FileCopyrightText: 2022 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include "timezone_database.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "timezone_map_util.h"
+
+namespace installer {
+
+const TimezoneDatabase& TimezoneDatabase::instance() {
+  // Initialization of function-local statics is thread-safe since C++11.
+  static const TimezoneDatabase database;
+  return database;
+}
+
+TimezoneDatabase::TimezoneDatabase()
+    : zones_(GetZoneInfoList()) {
+  positions_.reserve(zones_.length());
+  for (int index = 0; index < zones_.length(); index++) {
+    const ZoneInfo& zone = zones_.at(index);
+    positions_.append(QPointF(ConvertLongitudeToX(zone.longitude),
+                              ConvertLatitudeToY(zone.latitude)));
+    zone_index_.insert(zone.timezone, index);
+    if (!country_index_.contains(zone.country)) {
+      country_index_.insert(zone.country, index);
+    }
+  }
+
+  this->buildGrid();
+}
+
+int TimezoneDatabase::indexOfZone(const QString& timezone) const {
+  return zone_index_.value(timezone, -1);
+}
+
+int TimezoneDatabase::indexOfCountry(const QString& country) const {
+  return country_index_.value(country, -1);
+}
+
+ZoneInfoList TimezoneDatabase::nearestZones(double threshold, int x, int y,
+                                            int map_width,
+                                            int map_height) const {
+  ZoneInfoList zones;
+  if (zones_.isEmpty() || map_width <= 0 || map_height <= 0) {
+    return zones;
+  }
+
+  auto distance = [&](int index) {
+    const double dx = positions_.at(index).x() * map_width - x;
+    const double dy = positions_.at(index).y() * map_height - y;
+    return dx * dx + dy * dy;
+  };
+
+  const double map_x = double(x) / map_width;
+  const double map_y = double(y) / map_height;
+
+  // Only cells overlapping the threshold circle may contain matched zones.
+  const double radius = std::sqrt(std::max(threshold, 0.0));
+  const int left = cellColumn(map_x - radius / map_width);
+  const int right = cellColumn(map_x + radius / map_width);
+  const int top = cellRow(map_y - radius / map_height);
+  const int bottom = cellRow(map_y + radius / map_height);
+
+  QVector<int> matched;
+  for (int row = top; row <= bottom; row++) {
+    for (int column = left; column <= right; column++) {
+      for (int index : cell(column, row)) {
+        if (distance(index) <= threshold) {
+          matched.append(index);
+        }
+      }
+    }
+  }
+
+  if (!matched.isEmpty()) {
+    std::sort(matched.begin(), matched.end());
+    for (int index : matched) {
+      zones.append(zones_.at(index));
+    }
+    return zones;
+  }
+
+  // Get the nearest zone, searching rings of cells around the clicked cell.
+  // Zones outside ring |ring| are at least |ring| cells away.
+  const int center_column = cellColumn(map_x);
+  const int center_row = cellRow(map_y);
+  const double ring_step = std::min(cell_width_ * map_width,
+                                    cell_height_ * map_height);
+  int nearest_index = -1;
+  double minimum_distance = 0.0;
+  for (int ring = 0; ring < kGridSize; ring++) {
+    for (int row = center_row - ring; row <= center_row + ring; row++) {
+      if (row < 0 || row >= kGridSize) {
+        continue;
+      }
+      for (int column = center_column - ring; column <= center_column + ring;
+           column++) {
+        if (column < 0 || column >= kGridSize) {
+          continue;
+        }
+        // Only the border of the ring, inner cells are already visited.
+        if (std::abs(row - center_row) != ring &&
+            std::abs(column - center_column) != ring) {
+          continue;
+        }
+        for (int index : cell(column, row)) {
+          const double d = distance(index);
+          if (nearest_index == -1 || d < minimum_distance ||
+              (d == minimum_distance && index < nearest_index)) {
+            minimum_distance = d;
+            nearest_index = index;
+          }
+        }
+      }
+    }
+
+    if (nearest_index != -1 &&
+        minimum_distance <= (ring * ring_step) * (ring * ring_step)) {
+      break;
+    }
+  }
+
+  zones.append(zones_.at(nearest_index));
+  return zones;
+}
+
+void TimezoneDatabase::buildGrid() {
+  grid_ = QVector<QVector<int>>(kGridSize * kGridSize);
+  if (positions_.isEmpty()) {
+    return;
+  }
+
+  double min_x = positions_.first().x();
+  double max_x = min_x;
+  double min_y = positions_.first().y();
+  double max_y = min_y;
+  for (const QPointF& pos : positions_) {
+    min_x = std::min(min_x, pos.x());
+    max_x = std::max(max_x, pos.x());
+    min_y = std::min(min_y, pos.y());
+    max_y = std::max(max_y, pos.y());
+  }
+
+  grid_origin_ = QPointF(min_x, min_y);
+  cell_width_ = (max_x > min_x) ? (max_x - min_x) / kGridSize : 1.0;
+  cell_height_ = (max_y > min_y) ? (max_y - min_y) / kGridSize : 1.0;
+
+  for (int index = 0; index < positions_.length(); index++) {
+    const QPointF& pos = positions_.at(index);
+    grid_[cellRow(pos.y()) * kGridSize + cellColumn(pos.x())].append(index);
+  }
+}
+
+int TimezoneDatabase::cellColumn(double x) const {
+  const double column = std::floor((x - grid_origin_.x()) / cell_width_);
+  return int(qBound(0.0, column, double(kGridSize - 1)));
+}
+
+int TimezoneDatabase::cellRow(double y) const {
+  const double row = std::floor((y - grid_origin_.y()) / cell_height_);
+  return int(qBound(0.0, row, double(kGridSize - 1)));
+}
+
+}  // namespace installer
@@ -0,0 +1,69 @@
+// SPDX-FileCopyrightText: 2022 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#ifndef INSTALLER_SYSINFO_TIMEZONE_DATABASE_H
+#define INSTALLER_SYSINFO_TIMEZONE_DATABASE_H
+
+#include <QHash>
+#include <QPointF>
+#include <QVector>
+
+#include "timezone.h"
+
+namespace installer {
+
+// Process-wide cache of zone1970.tab.
+// The table is read once on first use and never changes afterwards, so the
+// instance can be shared across threads without locking.
+// Zone positions on the world map are projected at load time and bucketed
+// into a uniform grid, so nearest-zone queries only visit nearby cells.
+class TimezoneDatabase {
+ public:
+  static const TimezoneDatabase& instance();
+
+  const ZoneInfoList& zones() const { return zones_; }
+
+  // Returns index of zone in zones(), or -1 if not found.
+  int indexOfZone(const QString& timezone) const;
+  // Returns index of first zone of |country|, or -1 if not found.
+  int indexOfCountry(const QString& country) const;
+
+  // Position of zone at |index| on a map of size 1x1.
+  // Same as (ConvertLongitudeToX(), ConvertLatitudeToY()).
+  const QPointF& position(int index) const { return positions_.at(index); }
+
+  // Get a list of zone info whose squared distance to (x, y) is not greater
+  // than |threshold| in a world map with size (map_width, map_height),
+  // in the order of zones(). If there is none, returns the nearest zone.
+  ZoneInfoList nearestZones(double threshold, int x, int y,
+                            int map_width, int map_height) const;
+
+ private:
+  TimezoneDatabase();
+  Q_DISABLE_COPY(TimezoneDatabase)
+
+  void buildGrid();
+  int cellColumn(double x) const;
+  int cellRow(double y) const;
+  const QVector<int>& cell(int column, int row) const {
+    return grid_.at(row * kGridSize + column);
+  }
+
+  static const int kGridSize = 32;
+
+  ZoneInfoList zones_;
+  QVector<QPointF> positions_;
+  QHash<QString, int> zone_index_;
+  QHash<QString, int> country_index_;
+
+  // Zone indexes in each cell, row-major, ascending in each cell.
+  QVector<QVector<int>> grid_;
+  QPointF grid_origin_;
+  double cell_width_ = 1.0;
+  double cell_height_ = 1.0;
+};
+
+}  // namespace installer
+
+#endif  // INSTALLER_SYSINFO_TIMEZONE_DATABASE_H
@@ -0,0 +1,175 @@
+// SPDX-FileCopyrightText: 2022 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include "timezone_localizer.h"
+
+#include <QDateTime>
+#include <QDebug>
+#include <QFile>
+#include <QMutexLocker>
+#include <QTimeZone>
+
+namespace installer {
+
+namespace {
+
+// Domain name for timezones.
+const char kTimezoneDomain[] = "deepin-installer-timezones";
+
+// Folder of gettext catalogs, same as the default of bindtextdomain().
+const char kLocaleDir[] = "/usr/share/locale";
+
+const quint32 kMoMagic = 0x950412de;
+const quint32 kMoMagicSwapped = 0xde120495;
+
+// Remove continent name from |local_name|.
+QString StripContinent(const QString& local_name) {
+  int index = local_name.lastIndexOf('/');
+  if (index == -1) {
+    // Some translations of locale name contains non-standard char.
+    index = local_name.lastIndexOf(QStringLiteral("∕"));
+  }
+  return (index > -1) ? local_name.mid(index + 1) : local_name;
+}
+
+// Catalog folders to try for |locale|, in the order used by gettext.
+// e.g. zh_CN.UTF-8 -> zh_CN, zh
+QStringList LocaleCandidates(const QString& locale) {
+  QString name = locale;
+  const int codeset = name.indexOf('.');
+  if (codeset > -1) {
+    name = name.left(codeset);
+  }
+  const int modifier = name.indexOf('@');
+  if (modifier > -1) {
+    name = name.left(modifier);
+  }
+
+  QStringList candidates;
+  if (!name.isEmpty()) {
+    candidates.append(name);
+  }
+  const int territory = name.indexOf('_');
+  if (territory > 0) {
+    candidates.append(name.left(territory));
+  }
+  return candidates;
+}
+
+quint32 ReadUint32(const QByteArray& data, int offset, bool swapped) {
+  const uchar* p = reinterpret_cast<const uchar*>(data.constData()) + offset;
+  if (swapped) {
+    return (quint32(p[0]) << 24) | (quint32(p[1]) << 16) |
+           (quint32(p[2]) << 8) | quint32(p[3]);
+  }
+  return (quint32(p[3]) << 24) | (quint32(p[2]) << 16) |
+         (quint32(p[1]) << 8) | quint32(p[0]);
+}
+
+// Read string at |index| of the string table at |table_offset|.
+bool ReadMoString(const QByteArray& data, quint32 table_offset, quint32 index,
+                  bool swapped, QByteArray* str) {
+  const quint32 entry = table_offset + index * 8;
+  if (entry + 8 > quint32(data.size())) {
+    return false;
+  }
+  const quint32 length = ReadUint32(data, int(entry), swapped);
+  const quint32 offset = ReadUint32(data, int(entry + 4), swapped);
+  if (offset > quint32(data.size()) || length > quint32(data.size()) - offset) {
+    return false;
+  }
+  *str = QByteArray(data.constData() + offset, int(length));
+  return true;
+}
+
+// Parse a GNU gettext .mo file into |catalog|, see the "MO Files" section of
+// gettext manual. Returns false if |data| is not a valid catalog.
+bool ParseMoFile(const QByteArray& data, QHash<QString, QString>* catalog) {
+  if (data.size() < 20) {
+    return false;
+  }
+
+  const quint32 magic = ReadUint32(data, 0, false);
+  if (magic != kMoMagic && magic != kMoMagicSwapped) {
+    return false;
+  }
+  const bool swapped = (magic == kMoMagicSwapped);
+  const quint32 count = ReadUint32(data, 8, swapped);
+  const quint32 original_table = ReadUint32(data, 12, swapped);
+  const quint32 translation_table = ReadUint32(data, 16, swapped);
+
+  for (quint32 index = 0; index < count; index++) {
+    QByteArray original;
+    QByteArray translation;
+    if (!ReadMoString(data, original_table, index, swapped, &original) ||
+        !ReadMoString(data, translation_table, index, swapped, &translation)) {
+      return false;
+    }
+    // Empty msgid is the catalog header.
+    if (original.isEmpty()) {
+      continue;
+    }
+    // Only the singular form of plural entries is used.
+    const int nul = translation.indexOf('\0');
+    if (nul > -1) {
+      translation.truncate(nul);
+    }
+    catalog->insert(QString::fromUtf8(original),
+                    StripContinent(QString::fromUtf8(translation)));
+  }
+  return true;
+}
+
+}  // namespace
+
+TimezoneLocalizer& TimezoneLocalizer::instance() {
+  static TimezoneLocalizer localizer;
+  return localizer;
+}
+
+QString TimezoneLocalizer::localName(const QString& timezone,
+                                     const QString& locale) {
+  const QSharedPointer<const Catalog> names = this->catalog(locale);
+  const auto it = names->constFind(timezone);
+  // Same as dgettext(), untranslated timezone is used as is.
+  return (it != names->cend()) ? it.value() : StripContinent(timezone);
+}
+
+TimezoneOffset TimezoneLocalizer::offset(const QString& timezone) const {
+  const QTimeZone zone(timezone.toUtf8());
+  const QDateTime now = QDateTime::currentDateTimeUtc();
+  const TimezoneOffset offset = {
+    zone.abbreviation(now),
+    zone.offsetFromUtc(now)
+  };
+  return offset;
+}
+
+QSharedPointer<const TimezoneLocalizer::Catalog> TimezoneLocalizer::catalog(
+    const QString& locale) {
+  QMutexLocker locker(&mutex_);
+  auto it = catalogs_.constFind(locale);
+  if (it != catalogs_.cend()) {
+    return it.value();
+  }
+
+  QSharedPointer<Catalog> names(new Catalog);
+  for (const QString& candidate : LocaleCandidates(locale)) {
+    QFile file(QString("%1/%2/LC_MESSAGES/%3.mo")
+                   .arg(kLocaleDir, candidate, kTimezoneDomain));
+    if (!file.open(QIODevice::ReadOnly)) {
+      continue;
+    }
+    if (ParseMoFile(file.readAll(), names.data())) {
+      break;
+    }
+    qWarning() << "Invalid timezone catalog:" << file.fileName();
+    names->clear();
+  }
+
+  catalogs_.insert(locale, names);
+  return names;
+}
+
+}  // namespace installer
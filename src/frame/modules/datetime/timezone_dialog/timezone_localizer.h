@@ -0,0 +1,47 @@
+// SPDX-FileCopyrightText: 2022 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#ifndef INSTALLER_SYSINFO_TIMEZONE_LOCALIZER_H
+#define INSTALLER_SYSINFO_TIMEZONE_LOCALIZER_H
+
+#include <QHash>
+#include <QMutex>
+#include <QSharedPointer>
+#include <QStringList>
+
+#include "timezone.h"
+
+namespace installer {
+
+// Localized timezone names and UTC offsets without touching process-global
+// state, so they can be computed from any thread.
+// Names are read from the timezone gettext catalog directly instead of
+// setlocale() + dgettext(); each catalog is parsed once per locale and kept.
+// Offsets come from QTimeZone, which reads tzdata instead of setting TZ.
+class TimezoneLocalizer {
+ public:
+  static TimezoneLocalizer& instance();
+
+  // Returns local name of |timezone|, excluding continent name.
+  // |locale| is desired locale name, like zh_CN.
+  QString localName(const QString& timezone, const QString& locale);
+
+  // Get |timezone| GMT offset at current time.
+  TimezoneOffset offset(const QString& timezone) const;
+
+ private:
+  TimezoneLocalizer() = default;
+  Q_DISABLE_COPY(TimezoneLocalizer)
+
+  // Timezone -> local name, excluding continent name.
+  typedef QHash<QString, QString> Catalog;
+  QSharedPointer<const Catalog> catalog(const QString& locale);
+
+  QMutex mutex_;
+  QHash<QString, QSharedPointer<const Catalog>> catalogs_;
+};
+
+}  // namespace installer
+
+#endif  // INSTALLER_SYSINFO_TIMEZONE_LOCALIZER_H
@@ -19,6 +19,7 @@
 #include "widgets/basiclistdelegate.h"
 
 #include "file_util.h"
+#include "timezone_database.h"
 #include "timezone_map_util.h"
 #include "popup_menu.h"
 #include "tooltip_pin.h"
@@ -51,7 +52,6 @@ TimezoneMap::TimezoneMap(QWidget* parent)
     : QFrame(parent),
       m_systemActiveColor(QString("")),
       current_zone_(),
-      total_zones_(GetZoneInfoList()),
       nearest_zones_() {
   this->setObjectName("timezone_map");
   this->setAccessibleName("timezone_map");
@@ -80,10 +80,11 @@ void TimezoneMap::setSystemActiveColor(const QString &color)
 bool TimezoneMap::setTimezone(const QString &timezone)
 {
     nearest_zones_.clear();
-    const int index = GetZoneInfoByZone(total_zones_, timezone);
+    const TimezoneDatabase &database = TimezoneDatabase::instance();
+    const int index = database.indexOfZone(timezone);
     if (index > -1) {
         // 找到时区并标记到地图上
-        current_zone_ = total_zones_.at(index);
+        current_zone_ = database.zones().at(index);
         nearest_zones_.append(current_zone_);
         this->remark();
         return true;
@@ -98,9 +99,9 @@ bool TimezoneMap::setTimezone(const QString &timezone)
 void TimezoneMap::mousePressEvent(QMouseEvent* event) {
   if (event->button() == Qt::LeftButton) {
     // Get nearest zones around mouse.
-    nearest_zones_ = GetNearestZones(total_zones_, kDistanceThreshold,
-                                     event->x(), event->y(),
-                                     this->width(), this->height());
+    nearest_zones_ = TimezoneDatabase::instance().nearestZones(
+        kDistanceThreshold, event->x(), event->y(),
+        this->width(), this->height());
     qDebug() << nearest_zones_;
     current_zone_ = nearest_zones_.first();
     if (nearest_zones_.length() == 1) {
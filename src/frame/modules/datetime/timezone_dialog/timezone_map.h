@@ -59,9 +59,6 @@ class TimezoneMap : public QFrame {
   // Currently selected/marked timezone.
   ZoneInfo current_zone_;
 
-  // A list of zone info found in system.
-  const ZoneInfoList total_zones_;
-
   // A list of zone info which are near enough to current cursor position.
   ZoneInfoList nearest_zones_;
 
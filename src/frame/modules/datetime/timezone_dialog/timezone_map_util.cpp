@@ -38,33 +38,4 @@ double ConvertLongitudeToX(double longitude) {
   return ((180.0 + longitude) / 360.0 + xdeg_offset / 180.0);
 }
 
-ZoneInfoList GetNearestZones(const ZoneInfoList& total_zones, double threshold,
-                             int x, int y, int map_width, int map_height) {
-  ZoneInfoList zones;
-  double minimum_distance = map_width * map_width + map_height * map_height;
-  int nearest_zone_index = -1;
-  for (int index = 0; index < total_zones.length(); index++) {
-    const ZoneInfo& zone = total_zones.at(index);
-    const double point_x = ConvertLongitudeToX(zone.longitude) * map_width;
-    const double point_y = ConvertLatitudeToY(zone.latitude) * map_height;
-    const double dx = point_x - x;
-    const double dy = point_y - y;
-    const double distance = dx * dx + dy * dy;
-    if (distance < minimum_distance) {
-      minimum_distance = distance;
-      nearest_zone_index = index;
-    }
-    if (distance <= threshold) {
-      zones.append(zone);
-    }
-  }
-
-  // Get the nearest zone.
-  if (zones.isEmpty()) {
-    zones.append(total_zones.at(nearest_zone_index));
-  }
-
-  return zones;
-}
-
 }  // namespace installer
@@ -4,6 +4,7 @@
 
 #include "timezonechooser.h"
 #include "timezone_map.h"
+#include "timezone_database.h"
 #include "widgets/searchinput.h"
 #include "../datetimemodel.h"
 
@@ -28,6 +29,8 @@
 #include <QStyleFactory>
 #include <QAbstractItemView>
 #include <QGraphicsOpacityEffect>
+#include <QFutureWatcher>
+#include <QtConcurrent>
 
 DWIDGET_USE_NAMESPACE
 
@@ -37,6 +40,7 @@ using namespace dcc::datetime;
 TimeZoneChooser::TimeZoneChooser(QWidget* parent)
     : DAbstractDialog(parent)
     , m_blurEffect(new DBlurEffectWidget(this))
+    , m_popup(nullptr)
     , m_map(new installer::TimezoneMap(this))
     , m_searchInput(new SearchInput(this))
     , m_title(new QLabel)
@@ -45,7 +49,8 @@ TimeZoneChooser::TimeZoneChooser(QWidget* parent)
     , m_currLangSelector(new LangSelector("com.deepin.daemon.LangSelector",
                                           "/com/deepin/daemon/LangSelector",
                                           QDBusConnection::sessionBus(), this))
-    , m_totalZones(installer::GetZoneInfoList())
+    , m_completer(nullptr)
+    , m_totalZones(installer::TimezoneDatabase::instance().zones())
     , m_model(nullptr)
 {
     setAttribute(Qt::WA_TranslucentBackground);
@@ -141,16 +146,27 @@ TimeZoneChooser::TimeZoneChooser(QWidget* parent)
         setRightBtnState();
     });
 
-    QTimer::singleShot(0, [this] {
+    // 本地化时区名不依赖全局 locale，在工作线程中生成，不阻塞对话框的显示
+    using Completion = QPair<QString, QString>;
+    QFutureWatcher<QVector<Completion>> *completionWatcher = new QFutureWatcher<QVector<Completion>>(this);
+    completionWatcher->setFuture(QtConcurrent::run([zones = m_totalZones, locale = QLocale::system().name()] {
+        QVector<Completion> result;
+        result.reserve(zones.size());
+        for (const auto &zoneInfo : zones)
+            result << qMakePair(zoneInfo.timezone, installer::GetLocalTimezoneName(zoneInfo.timezone, locale));
+        return result;
+    }));
+    connect(completionWatcher, &QFutureWatcher<QVector<Completion>>::finished, this, [this, completionWatcher] {
+        completionWatcher->deleteLater();
+
         QStringList completions;
         QStringList completions_filter;
-        for (const auto &zoneInfo : m_totalZones) {
-            auto timezone = zoneInfo.timezone;
+        for (const auto &completion : completionWatcher->result()) {
+            const QString &timezone = completion.first;
             completions << timezone; // timezone as completion candidate.
 
             // localized timezone as completion candidate.
-            const QString locale = QLocale::system().name();
-            QString localizedTimezone = installer::GetLocalTimezoneName(timezone, locale);
+            const QString &localizedTimezone = completion.second;
             completions << localizedTimezone;
 
             m_completionCache[localizedTimezone] = timezone;
@@ -192,6 +208,10 @@ TimeZoneChooser::TimeZoneChooser(QWidget* parent)
         blurEffect->lower();
     });
     connect(m_searchInput, &SearchInput::returnPressed, [this] {
+        // 补全列表还未生成
+        if (!m_popup)
+            return;
+
         QModelIndex index = m_popup->model()->index(0, 0);
         if (index.isValid()) {
             m_searchInput->setText(index.data().toString());
@@ -0,0 +1,73 @@
+// SPDX-FileCopyrightText: 2022 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include "dbuspropertysnapshot.h"
+
+#include <QDBusMessage>
+#include <QDBusPendingCallWatcher>
+#include <QDBusPendingReply>
+#include <QDebug>
+
+using namespace dcc;
+
+const QString PropertiesInterface("org.freedesktop.DBus.Properties");
+
+DBusPropertySnapshot::DBusPropertySnapshot(const QString &service, const QString &path, const QString &interface,
+                                           const QDBusConnection &connection, QObject *parent)
+    : QObject(parent)
+    , m_service(service)
+    , m_path(path)
+    , m_interface(interface)
+    , m_connection(connection)
+    , m_watcher(nullptr)
+    , m_ready(false)
+{
+}
+
+void DBusPropertySnapshot::fetch()
+{
+    if (m_watcher)
+        return;
+
+    QDBusMessage msg = QDBusMessage::createMethodCall(m_service, m_path, PropertiesInterface, "GetAll");
+    msg << m_interface;
+
+    m_watcher = new QDBusPendingCallWatcher(m_connection.asyncCall(msg), this);
+    connect(m_watcher, &QDBusPendingCallWatcher::finished, this, &DBusPropertySnapshot::onFetchFinished);
+}
+
+bool DBusPropertySnapshot::waitForReady()
+{
+    fetch();
+
+    // waitForFinished 返回前会投递 finished 信号，这里只是兜底
+    QDBusPendingCallWatcher *watcher = m_watcher;
+    watcher->waitForFinished();
+    if (m_watcher == watcher)
+        onFetchFinished(watcher);
+
+    return m_ready;
+}
+
+void DBusPropertySnapshot::onFetchFinished(QDBusPendingCallWatcher *watcher)
+{
+    if (watcher != m_watcher)
+        return;
+
+    m_watcher = nullptr;
+    watcher->deleteLater();
+
+    QDBusPendingReply<QVariantMap> reply = *watcher;
+    if (reply.isError()) {
+        m_error = reply.error();
+        qWarning() << "GetAll" << m_interface << "on" << m_path << "failed:" << m_error.message();
+        Q_EMIT failed(m_error);
+        return;
+    }
+
+    m_properties = reply.value();
+    m_error = QDBusError();
+    m_ready = true;
+    Q_EMIT ready();
+}
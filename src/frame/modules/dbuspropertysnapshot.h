@@ -0,0 +1,82 @@
+// SPDX-FileCopyrightText: 2022 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#ifndef DBUSPROPERTYSNAPSHOT_H
+#define DBUSPROPERTYSNAPSHOT_H
+
+#include <QDBusArgument>
+#include <QDBusConnection>
+#include <QDBusError>
+#include <QObject>
+#include <QVariantMap>
+
+class QDBusPendingCallWatcher;
+
+namespace dcc {
+
+// D-Bus 对象的属性快照
+// 用一次 org.freedesktop.DBus.Properties.GetAll 取回接口的全部属性，完成后发出一次 ready，
+// 代替逐个属性的 Get 请求。初始化时从快照读取初值，之后的变化仍由代理的 xxxChanged 信号同步
+//
+// 快照不会自动刷新；需要最新值时重新调用 fetch
+class DBusPropertySnapshot : public QObject
+{
+    Q_OBJECT
+
+public:
+    DBusPropertySnapshot(const QString &service, const QString &path, const QString &interface,
+                         const QDBusConnection &connection, QObject *parent = nullptr);
+
+    // 从已有代理构造，服务、路径、接口和总线与代理一致
+    template<typename Proxy>
+    explicit DBusPropertySnapshot(Proxy *proxy, QObject *parent = nullptr)
+        : DBusPropertySnapshot(proxy->service(), proxy->path(), proxy->interface(), proxy->connection(), parent)
+    {
+    }
+
+    // 发出异步 GetAll 请求，已有未完成的请求时不会重复发送
+    void fetch();
+    // 阻塞等待当前请求完成，未发出请求时先发出请求；返回是否成功
+    bool waitForReady();
+
+    bool isReady() const { return m_ready; }
+    bool isPending() const { return m_watcher != nullptr; }
+    const QDBusError &error() const { return m_error; }
+
+    bool contains(const QString &name) const { return m_properties.contains(name); }
+    const QVariantMap &properties() const { return m_properties; }
+
+    // 复合类型在 GetAll 的结果中是 QDBusArgument，这里统一解包成 T
+    template<typename T>
+    T value(const QString &name, const T &defaultValue = T()) const
+    {
+        auto it = m_properties.constFind(name);
+        if (it == m_properties.constEnd())
+            return defaultValue;
+
+        return qdbus_cast<T>(it.value());
+    }
+
+Q_SIGNALS:
+    void ready();
+    void failed(const QDBusError &error);
+
+private:
+    void onFetchFinished(QDBusPendingCallWatcher *watcher);
+
+private:
+    QString m_service;
+    QString m_path;
+    QString m_interface;
+    QDBusConnection m_connection;
+
+    QDBusPendingCallWatcher *m_watcher;
+    QVariantMap m_properties;
+    QDBusError m_error;
+    bool m_ready;
+};
+
+}
+
+#endif // DBUSPROPERTYSNAPSHOT_H
@@ -0,0 +1,39 @@
+// SPDX-FileCopyrightText: 2022 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include "dbusproxyregistry.h"
+
+#include <QHash>
+
+using namespace dcc;
+
+// 注册表只持有弱引用，代理的生命周期由使用者决定
+static QHash<QString, std::weak_ptr<QObject>> &proxies()
+{
+    static QHash<QString, std::weak_ptr<QObject>> registry;
+    return registry;
+}
+
+std::shared_ptr<QObject> DBusProxyRegistry::find(const QString &key)
+{
+    auto it = proxies().find(key);
+    if (it == proxies().end())
+        return nullptr;
+
+    std::shared_ptr<QObject> proxy = it.value().lock();
+    if (!proxy)
+        proxies().erase(it);
+
+    return proxy;
+}
+
+std::shared_ptr<QObject> DBusProxyRegistry::insert(const QString &key, QObject *proxy)
+{
+    // 最后一个引用可能在代理自身的信号处理中释放，延迟删除
+    std::shared_ptr<QObject> ptr(proxy, [](QObject *obj) {
+        obj->deleteLater();
+    });
+    proxies().insert(key, ptr);
+    return ptr;
+}
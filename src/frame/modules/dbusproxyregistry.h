@@ -0,0 +1,75 @@
+// SPDX-FileCopyrightText: 2022 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#ifndef DBUSPROXYREGISTRY_H
+#define DBUSPROXYREGISTRY_H
+
+#include <QDBusConnection>
+#include <QObject>
+#include <QString>
+
+#include <memory>
+
+namespace dcc {
+
+// 共享 D-Bus 代理的引用，用法与裸指针相同，最后一个引用释放时代理随之销毁
+template<typename T>
+class SharedDBusProxy
+{
+public:
+    SharedDBusProxy() = default;
+    explicit SharedDBusProxy(std::shared_ptr<T> proxy)
+        : m_proxy(std::move(proxy))
+    {
+    }
+
+    T *get() const { return m_proxy.get(); }
+    T *operator->() const { return m_proxy.get(); }
+    operator T *() const { return m_proxy.get(); }
+
+private:
+    std::shared_ptr<T> m_proxy;
+};
+
+// 进程内的 D-Bus 代理注册表
+// 同一 (接口, 服务, 路径, 总线) 只创建一个代理，各模块共用其属性缓存和信号订阅，
+// 避免重复的匹配规则、内省和属性请求。只能在主线程中使用
+//
+// 共享代理统一工作在异步模式：读属性返回缓存值，值变化时发出对应的 Changed 信号；
+// 不要在共享代理上调用 setSync/blockSignals，需要立即读到当前值时使用 syncRead
+class DBusProxyRegistry
+{
+public:
+    template<typename T>
+    static SharedDBusProxy<T> get(const QString &service, const QString &path, const QDBusConnection &connection)
+    {
+        const QString &key = QString("%1|%2|%3|%4").arg(QString::fromLatin1(T::staticMetaObject.className()), service, path, connection.name());
+        std::shared_ptr<QObject> proxy = find(key);
+        if (!proxy) {
+            T *inter = new T(service, path, connection);
+            inter->setSync(false);
+            proxy = insert(key, inter);
+        }
+
+        return SharedDBusProxy<T>(std::static_pointer_cast<T>(proxy));
+    }
+
+    // 临时切换为同步模式读取属性，读取结果同时更新共享的缓存
+    template<typename T, typename Getter>
+    static auto syncRead(T *inter, Getter getter) -> decltype((inter->*getter)())
+    {
+        inter->setSync(true);
+        auto value = (inter->*getter)();
+        inter->setSync(false);
+        return value;
+    }
+
+private:
+    static std::shared_ptr<QObject> find(const QString &key);
+    static std::shared_ptr<QObject> insert(const QString &key, QObject *proxy);
+};
+
+}
+
+#endif // DBUSPROXYREGISTRY_H
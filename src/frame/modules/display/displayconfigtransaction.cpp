@@ -0,0 +1,222 @@
+// SPDX-FileCopyrightText: 2022 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include "displayconfigtransaction.h"
+#include "displaymodel.h"
+#include "displayworker.h"
+
+#include <QDebug>
+#include <QSet>
+#include <QTimer>
+
+using namespace dcc::display;
+
+// WaitForApply 时等待其他调用触发 ApplyChanges 的最长时间，超时后由事务自行调用
+static const int ApplyFallbackDelay = 1000;
+
+DisplayConfigTransaction::DisplayConfigTransaction(DisplayModel *model, DisplayWorker *worker, QObject *parent)
+    : QObject(parent)
+    , m_model(model)
+    , m_worker(worker)
+    , m_state(Idle)
+    , m_needApply(false)
+    , m_confirmTimeout(0)
+    , m_confirmTimer(new QTimer(this))
+{
+    m_confirmTimer->setSingleShot(true);
+    connect(m_confirmTimer, &QTimer::timeout, this, &DisplayConfigTransaction::revert);
+}
+
+void DisplayConfigTransaction::setResolution(Monitor *mon, int modeId)
+{
+    m_changes.append({ ResolutionChange, mon, modeId, 0, QString() });
+}
+
+void DisplayConfigTransaction::setResolutionBySize(Monitor *mon, int width, int height)
+{
+    m_changes.append({ ResolutionBySizeChange, mon, width, height, QString() });
+}
+
+void DisplayConfigTransaction::setRotate(Monitor *mon, quint16 rotate)
+{
+    m_changes.append({ RotateChange, mon, rotate, 0, QString() });
+}
+
+void DisplayConfigTransaction::setFillMode(Monitor *mon, const QString &fillMode)
+{
+    m_changes.append({ FillModeChange, mon, 0, 0, fillMode });
+}
+
+void DisplayConfigTransaction::commit(ApplyMode mode, int confirmTimeout)
+{
+    if (m_state != Idle || !m_worker)
+        return;
+
+    takeSnapshot();
+    m_state = Applying;
+    m_needApply = mode == ApplyNow;
+    m_confirmTimeout = confirmTimeout;
+
+    for (const auto &change : m_changes)
+        applyChange(change);
+
+    switch (mode) {
+    case NoApply:
+        QTimer::singleShot(0, this, &DisplayConfigTransaction::onChangesApplied);
+        break;
+    case ApplyNow:
+        // 后端应用完成后才提示确认，提示框不会出现在屏幕切换之前
+        connect(m_worker, &DisplayWorker::changesApplied, this, &DisplayConfigTransaction::onChangesApplied);
+        m_worker->applyChanges();
+        break;
+    case WaitForApply:
+        connect(m_worker, &DisplayWorker::changesApplied, this, &DisplayConfigTransaction::onChangesApplied);
+        QTimer::singleShot(ApplyFallbackDelay, this, &DisplayConfigTransaction::onApplyTimeout);
+        break;
+    }
+}
+
+void DisplayConfigTransaction::confirm()
+{
+    if (m_state != Applying && m_state != AwaitingConfirmation)
+        return;
+
+    m_confirmTimer->stop();
+    if (m_worker)
+        disconnect(m_worker, &DisplayWorker::changesApplied, this, nullptr);
+
+    // 只有桌面显示方式的变更由属性直接生效，不需要保存
+    bool needSave = false;
+    for (const auto &change : m_changes)
+        needSave = needSave || change.type != FillModeChange;
+
+    if (needSave && m_worker)
+        m_worker->saveChanges();
+
+    m_state = Confirmed;
+    Q_EMIT finished(true);
+}
+
+void DisplayConfigTransaction::revert()
+{
+    if (m_state != Applying && m_state != AwaitingConfirmation)
+        return;
+
+    m_confirmTimer->stop();
+    if (m_worker) {
+        disconnect(m_worker, &DisplayWorker::changesApplied, this, nullptr);
+        restoreSnapshot();
+    }
+
+    m_state = Reverted;
+    Q_EMIT finished(false);
+}
+
+void DisplayConfigTransaction::takeSnapshot()
+{
+    m_snapshot.clear();
+    for (auto mon : m_model->monitorList())
+        m_snapshot.insert(mon, { mon->currentMode(), mon->rotate(), mon->currentFillMode() });
+}
+
+void DisplayConfigTransaction::applyChange(const Change &change)
+{
+    switch (change.type) {
+    case ResolutionChange:
+        m_worker->setMonitorResolution(change.monitor, change.value);
+        break;
+    case ResolutionBySizeChange:
+        m_worker->setMonitorResolutionBySize(change.monitor, change.value, change.height);
+        break;
+    case RotateChange:
+#ifndef DCC_DISABLE_ROTATE
+        m_worker->setMonitorRotate(change.monitor, static_cast<quint16>(change.value));
+#endif
+        break;
+    case FillModeChange:
+        m_worker->setCurrentFillMode(change.monitor, change.fillMode);
+        break;
+    }
+}
+
+void DisplayConfigTransaction::onChangesApplied()
+{
+    if (m_state != Applying)
+        return;
+
+    if (m_worker)
+        disconnect(m_worker, &DisplayWorker::changesApplied, this, nullptr);
+
+    m_state = AwaitingConfirmation;
+    if (m_confirmTimeout > 0)
+        m_confirmTimer->start(m_confirmTimeout);
+
+    Q_EMIT awaitingConfirmation();
+}
+
+void DisplayConfigTransaction::onApplyTimeout()
+{
+    // 没有其他调用触发 ApplyChanges（如位置不需要调整），由事务补上，仍等待应用完成
+    if (m_state != Applying || !m_worker)
+        return;
+
+    qDebug() << "display config: no ApplyChanges within" << ApplyFallbackDelay << "ms, apply it now";
+    m_worker->applyChanges();
+}
+
+void DisplayConfigTransaction::restoreSnapshot()
+{
+    // 只还原变更涉及的屏幕和属性；修改分辨率可能改变桌面显示方式，一并还原
+    QSet<Monitor *> modeChanged;
+    QSet<Monitor *> rotateChanged;
+    QSet<Monitor *> fillModeChanged;
+    for (const auto &change : m_changes) {
+        switch (change.type) {
+        case ResolutionChange:
+        case ResolutionBySizeChange:
+            modeChanged << change.monitor;
+            fillModeChanged << change.monitor;
+            break;
+        case RotateChange:
+            rotateChanged << change.monitor;
+            break;
+        case FillModeChange:
+            fillModeChanged << change.monitor;
+            break;
+        }
+    }
+
+    const QList<Monitor *> monitors = m_model->monitorList();
+    bool needApply = false;
+    for (auto it(m_snapshot.cbegin()); it != m_snapshot.cend(); ++it) {
+        Monitor *mon = it.key();
+        // 等待确认期间被拔出的屏幕
+        if (!monitors.contains(mon))
+            continue;
+
+        const MonitorState &state = it.value();
+        if (modeChanged.contains(mon)) {
+            m_worker->setMonitorResolution(mon, static_cast<int>(state.mode.id()));
+            // 与下发变更时一致，扩展模式下由位置调整统一应用
+            needApply = needApply || m_needApply;
+        }
+
+#ifndef DCC_DISABLE_ROTATE
+        // 若是重力感应，调整后不对数据进行还原
+        if (rotateChanged.contains(mon) && mon->currentRotateMode() != Monitor::RotateMode::Gravity) {
+            m_worker->setMonitorRotate(mon, state.rotate);
+            needApply = true;
+        }
+#endif
+
+        if (fillModeChanged.contains(mon) && !state.fillMode.isEmpty())
+            m_worker->setCurrentFillMode(mon, state.fillMode);
+    }
+
+    if (needApply)
+        m_worker->applyChanges();
+
+    qDebug() << "display config reverted, mode:" << modeChanged.size() << "rotate:" << rotateChanged.size()
+             << "fill mode:" << fillModeChanged.size();
+}
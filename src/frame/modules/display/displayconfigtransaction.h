@@ -0,0 +1,109 @@
+// SPDX-FileCopyrightText: 2022 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#ifndef DISPLAYCONFIGTRANSACTION_H
+#define DISPLAYCONFIGTRANSACTION_H
+
+#include "monitor.h"
+
+#include <QHash>
+#include <QObject>
+#include <QPointer>
+
+class QTimer;
+
+namespace dcc {
+
+namespace display {
+
+class DisplayModel;
+class DisplayWorker;
+
+// 需要用户确认的显示设置变更（分辨率、刷新率、旋转、桌面显示方式）
+// commit 时先保存所有屏幕的状态再下发变更，变更生效后等待确认；
+// 确认则保存配置，拒绝或超时则按保存的状态一次性还原，不依赖还原时模型中的值
+class DisplayConfigTransaction : public QObject
+{
+    Q_OBJECT
+
+public:
+    enum State {
+        Idle,
+        Applying,
+        AwaitingConfirmation,
+        Confirmed,
+        Reverted
+    };
+
+    enum ApplyMode {
+        NoApply,        // 变更由属性直接生效，不需要 ApplyChanges
+        ApplyNow,       // 由事务调用 ApplyChanges
+        WaitForApply    // 由其他调用（如扩展模式下的位置调整）触发 ApplyChanges，事务只等待其完成
+    };
+
+    struct MonitorState {
+        Resolution mode;
+        quint16 rotate;
+        QString fillMode;
+    };
+
+    explicit DisplayConfigTransaction(DisplayModel *model, DisplayWorker *worker, QObject *parent = nullptr);
+
+    // 记录变更，commit 时按记录的顺序下发
+    void setResolution(Monitor *mon, int modeId);
+    void setResolutionBySize(Monitor *mon, int width, int height);
+    void setRotate(Monitor *mon, quint16 rotate);
+    void setFillMode(Monitor *mon, const QString &fillMode);
+
+    // ApplyNow、WaitForApply 等后端应用完成后再进入等待确认状态；
+    // confirmTimeout 毫秒内未确认则自动还原，为 0 时一直等待
+    void commit(ApplyMode mode, int confirmTimeout = 0);
+    void confirm();
+    void revert();
+
+    inline State state() const { return m_state; }
+    inline const QHash<Monitor *, MonitorState> &snapshot() const { return m_snapshot; }
+
+Q_SIGNALS:
+    void awaitingConfirmation();
+    void finished(bool confirmed);
+
+private:
+    enum ChangeType {
+        ResolutionChange,
+        ResolutionBySizeChange,
+        RotateChange,
+        FillModeChange
+    };
+
+    struct Change {
+        ChangeType type;
+        Monitor *monitor;
+        int value;
+        int height;
+        QString fillMode;
+    };
+
+    void takeSnapshot();
+    void applyChange(const Change &change);
+    void onChangesApplied();
+    void onApplyTimeout();
+    void restoreSnapshot();
+
+private:
+    DisplayModel *m_model;
+    QPointer<DisplayWorker> m_worker;
+    State m_state;
+    QList<Change> m_changes;
+    QHash<Monitor *, MonitorState> m_snapshot;
+    bool m_needApply;
+    int m_confirmTimeout;
+    QTimer *m_confirmTimer;
+};
+
+} // namespace display
+
+} // namespace dcc
+
+#endif // DISPLAYCONFIGTRANSACTION_H
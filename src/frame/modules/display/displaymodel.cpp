@@ -102,6 +102,12 @@ void DisplayModel::setPrimary(const QString &primary)
 void DisplayModel::monitorAdded(Monitor *mon)
 {
     m_monitors.append(mon);
+    // 先于界面连接，界面收到模式列表变化时索引已经更新
+    connect(mon, &Monitor::modelListChanged, this, [this, mon] {
+        updateModeTable(mon);
+    });
+    updateModeTable(mon);
+
     //  按照名称排序，显示的时候VGA在前，HDMI在后
     qSort(m_monitors.begin(), m_monitors.end(), [=](const Monitor *m1, const Monitor *m2){
         return m1->name() > m2->name();
@@ -114,6 +120,9 @@ void DisplayModel::monitorAdded(Monitor *mon)
 void DisplayModel::monitorRemoved(Monitor *mon)
 {
     m_monitors.removeOne(mon);
+    disconnect(mon, &Monitor::modelListChanged, this, nullptr);
+    m_modeTables.remove(mon);
+    updateCommonModes();
     checkAllSupportFillModes();
 
     Q_EMIT monitorListChanged();
@@ -247,3 +256,35 @@ void DisplayModel::checkAllSupportFillModes()
     }
     m_allSupportFillModes = true;
 }
+
+const MonitorModeTable &DisplayModel::modeTable(const Monitor *mon) const
+{
+    static const MonitorModeTable empty;
+
+    auto it = m_modeTables.constFind(mon);
+    return it == m_modeTables.cend() ? empty : it.value();
+}
+
+void DisplayModel::updateModeTable(const Monitor *mon)
+{
+    m_modeTables[mon].rebuild(mon->modeList());
+    updateCommonModes();
+}
+
+void DisplayModel::updateCommonModes()
+{
+    m_commonResolutions.clear();
+    m_commonModes.clear();
+
+    bool first = true;
+    for (const auto &table : m_modeTables) {
+        if (first) {
+            m_commonResolutions = table.resolutionKeys();
+            m_commonModes = table.modeKeys();
+            first = false;
+        } else {
+            m_commonResolutions.intersect(table.resolutionKeys());
+            m_commonModes.intersect(table.modeKeys());
+        }
+    }
+}
@@ -8,6 +8,7 @@
 #include <QObject>
 
 #include "monitor.h"
+#include "monitormodetable.h"
 #include "types/brightnessmap.h"
 #include "types/touchscreeninfolist_v2.h"
 #include "types/touchscreenmap.h"
@@ -85,6 +86,12 @@ public:
     inline bool allSupportFillModes() const { return m_allSupportFillModes; }
     void checkAllSupportFillModes();
 
+    // 各屏幕模式列表的索引，随屏幕的模式列表变化更新
+    const MonitorModeTable &modeTable(const Monitor *mon) const;
+    // 所有屏幕都支持的分辨率和模式，复制模式下只能在这些模式中选择
+    inline bool isCommonResolution(const Resolution &r) const { return m_commonResolutions.contains(MonitorModeTable::resolutionKey(r)); }
+    inline bool isCommonMode(const Resolution &r) const { return m_commonModes.contains(MonitorModeTable::modeKey(r)); }
+
 Q_SIGNALS:
     void screenHeightChanged(const int h) const;
     void screenWidthChanged(const int w) const;
@@ -118,6 +125,10 @@ private Q_SLOTS:
     void setAutoLightAdjustIsValid(bool);
     void setmaxBacklightBrightness(const uint value);
 
+private:
+    void updateModeTable(const Monitor *mon);
+    void updateCommonModes();
+
 private:
     int m_screenHeight;
     int m_screenWidth;
@@ -140,6 +151,9 @@ private:
     TouchscreenMap m_touchMap;
     uint m_maxBacklightBrightness {0};
     bool m_allSupportFillModes;
+    QHash<const Monitor *, MonitorModeTable> m_modeTables;
+    QSet<MonitorModeTable::ResolutionKey> m_commonResolutions;
+    QSet<MonitorModeTable::ModeKey> m_commonModes;
 };
 
 } // namespace display
@@ -9,7 +9,6 @@
 #include <DApplicationHelper>
 
 #include <QDebug>
-#include <QtConcurrent>
 
 using namespace dcc;
 using namespace dcc::display;
@@ -27,22 +26,19 @@ DisplayWorker::DisplayWorker(DisplayModel *model, QObject *parent, bool isSync)
     , m_model(model)
     , m_displayInter(DisplayInterface, "/com/deepin/daemon/Display", QDBusConnection::sessionBus(), this)
     , m_dccSettings(new QGSettings("com.deepin.dde.control-center", QByteArray(), this))
-    , m_appearanceInter(new AppearanceInter("com.deepin.daemon.Appearance",
-                                            "/com/deepin/daemon/Appearance",
-                                            QDBusConnection::sessionBus(), this))
+    , m_appearanceInter(DBusProxyRegistry::get<AppearanceInter>("com.deepin.daemon.Appearance",
+                                                                "/com/deepin/daemon/Appearance",
+                                                                QDBusConnection::sessionBus()))
     , m_updateScale(false)
     , m_timer(new QTimer(this))
-    , m_powerInter(new PowerInter("com.deepin.daemon.Power", "/com/deepin/daemon/Power", QDBusConnection::sessionBus(), this))
+    , m_powerInter(DBusProxyRegistry::get<PowerInter>("com.deepin.daemon.Power", "/com/deepin/daemon/Power", QDBusConnection::sessionBus()))
+    , m_brightnessSaveTimer(new QTimer(this))
 {
     m_displayInter.setSync(isSync);
-    m_appearanceInter->setSync(isSync);
     m_timer->setSingleShot(true);
     m_timer->setInterval(200);
-
-    m_displayDBusInter = new QDBusInterface("com.deepin.daemon.Display",
-                                            "/com/deepin/daemon/Display",
-                                            "com.deepin.daemon.Display",
-                                            QDBusConnection::sessionBus());
+    m_brightnessSaveTimer->setSingleShot(true);
+    m_brightnessSaveTimer->setInterval(500);
 
     connect(&m_displayInter, &DisplayInter::MonitorsChanged, this, &DisplayWorker::onMonitorListChanged);
     connect(&m_displayInter, &DisplayInter::BrightnessChanged, this, &DisplayWorker::onMonitorsBrightnessChanged);
@@ -60,14 +56,20 @@ DisplayWorker::DisplayWorker(DisplayModel *model, QObject *parent, bool isSync)
     //display redSfit/autoLight
     connect(m_powerInter, &PowerInter::HasAmbientLightSensorChanged, m_model, &DisplayModel::autoLightAdjustVaildChanged);
     connect(m_dccSettings, &QGSettings::changed, this, &DisplayWorker::onGSettingsChanged);
+    connect(m_brightnessSaveTimer, &QTimer::timeout, this, &DisplayWorker::saveBrightness);
     connect(m_timer, &QTimer::timeout, this, [=] {
         m_displayInter.ApplyChanges().waitForFinished();
         m_displayInter.Save().waitForFinished();
+        Q_EMIT changesApplied();
     });
 }
 
 DisplayWorker::~DisplayWorker()
 {
+    // 退出前补上还没保存的亮度
+    if (m_brightnessSaveTimer->isActive())
+        saveBrightness();
+
     qDeleteAll(m_monitors.keys());
     qDeleteAll(m_monitors.values());
 }
@@ -99,7 +101,7 @@ void DisplayWorker::active()
     m_model->setAdjustCCTmode(m_displayInter.colorTemperatureMode());
     m_model->setColorTemperature(m_displayInter.colorTemperatureManual());
     m_model->setmaxBacklightBrightness(m_displayInter.maxBacklightBrightness());
-    m_model->setAutoLightAdjustIsValid(m_powerInter->hasAmbientLightSensor());
+    m_model->setAutoLightAdjustIsValid(DBusProxyRegistry::syncRead(m_powerInter.get(), &PowerInter::hasAmbientLightSensor));
 
     bool isRedshiftValid = true;
     QDBusInterface displayInter("com.deepin.daemon.Display","/com/deepin/daemon/Display",
@@ -133,14 +135,23 @@ void DisplayWorker::onMonitorListChanged(const QList<QDBusObjectPath> &mons)
     QList<QString> ops;
     for (const auto *mon : m_monitors.keys())
         ops << mon->path();
+    for (const auto *bringUp : m_pendingMonitors)
+        ops << bringUp->path();
 
     qDebug() << mons.size();
     QList<QString> pathList;
     for (const auto &op : mons) {
         const QString path = op.path();
         pathList << path;
-        if (!ops.contains(path))
-            monitorAdded(path);
+        if (ops.contains(path))
+            continue;
+
+        // 新屏幕的属性异步获取，全部就绪后再加入 model，不阻塞界面
+        MonitorBringUp *bringUp = new MonitorBringUp(DisplayInterface, path, this);
+        connect(bringUp, &MonitorBringUp::ready, this, &DisplayWorker::publishPendingMonitors);
+        connect(bringUp, &MonitorBringUp::failed, this, &DisplayWorker::publishPendingMonitors);
+        m_pendingMonitors << bringUp;
+        bringUp->start();
     }
 
     for (const auto &op : ops)
@@ -148,6 +159,22 @@ void DisplayWorker::onMonitorListChanged(const QList<QDBusObjectPath> &mons)
             monitorRemoved(op);
 }
 
+void DisplayWorker::publishPendingMonitors()
+{
+    // 按屏幕出现的顺序加入 model，前面的屏幕未就绪时后面的先等待
+    while (!m_pendingMonitors.isEmpty()) {
+        MonitorBringUp *bringUp = m_pendingMonitors.first();
+        if (bringUp->state() == MonitorBringUp::Running || bringUp->state() == MonitorBringUp::Idle)
+            return;
+
+        m_pendingMonitors.removeFirst();
+        if (bringUp->state() == MonitorBringUp::Ready)
+            monitorAdded(bringUp->takeInter(this), bringUp->properties(), bringUp->canBrightness());
+
+        bringUp->deleteLater();
+    }
+}
+
 void DisplayWorker::onMonitorsBrightnessChanged(const BrightnessMap &brightness)
 {
     if (brightness.isEmpty())
@@ -245,71 +272,61 @@ void DisplayWorker::setMonitorResolution(Monitor *mon, const int mode)
 
 void DisplayWorker::setMonitorBrightness(Monitor *mon, const double brightness)
 {
-    // m_displayInter.SetAndSaveBrightness(mon->name(), std::max(brightness, m_model->minimumBrightnessScale())).waitForFinished();
+    const QString &name = mon->name();
     double value = std::max(brightness, m_model->minimumBrightnessScale());
-    qDebug() << "setMonitorBrightness: receive request" << mon->name() << value;
-
-    //前面亮度设置未完成，只记录最新请求
-    QMutexLocker loker(&m_brightness.m_brightnessMutex);
-    m_brightness.m_hasWaitingRequest = true;
-    m_brightness.m_brightnessValue = value;
-    m_brightness.m_monitorName = mon->name();
-    if (!m_brightness.m_hasPendingRequest) {
-        QTimer::singleShot(0, this, &DisplayWorker::handleSetBrightnessRequest);
+    qDebug() << "setMonitorBrightness: receive request" << name << value;
+
+    // 拖动过程中只预览，同一屏幕只保留最新的值；停止拖动后统一保存一次
+    CoalescingSetter *setter = m_brightnessSetters.value(name);
+    if (!setter) {
+        setter = new CoalescingSetter([this, name](const QVariant &v) {
+            return QDBusPendingCall(m_displayInter.SetBrightness(name, v.toDouble()));
+        }, this);
+        setter->setObjectName("Brightness " + name);
+        m_brightnessSetters.insert(name, setter);
     }
+    setter->set(value);
+
+    m_brightnessToSave.insert(name, value);
+    m_brightnessSaveTimer->start();
 }
 
-void DisplayWorker::handleSetBrightnessRequest() {
-    qDebug() << "setMonitorBrightness enter";
-    QMutexLocker loker(&m_brightness.m_brightnessMutex);
-    if (m_brightness.m_hasPendingRequest) {
-        return;
-    }
-    if (!m_brightness.m_hasWaitingRequest) {
-        return;
+void DisplayWorker::saveBrightness()
+{
+    for (auto it = m_brightnessToSave.cbegin(); it != m_brightnessToSave.cend(); ++it) {
+        qDebug() << "setMonitorBrightness: save" << it.key() << it.value();
+        QDBusPendingCallWatcher *watcher = new QDBusPendingCallWatcher(m_displayInter.SetAndSaveBrightness(it.key(), it.value()), this);
+        connect(watcher, &QDBusPendingCallWatcher::finished, this, [](QDBusPendingCallWatcher *w) {
+            if (w->isError())
+                qWarning() << "SetAndSaveBrightness failed:" << w->error().message();
+            w->deleteLater();
+        });
     }
-
-    QFutureWatcher<void> *watcher = new QFutureWatcher<void>(this);
-    connect(watcher, &QFutureWatcher<QDBusPendingReply<>>::finished, [this, watcher] {
-        QMutexLocker loker(&m_brightness.m_brightnessMutex);
-        m_brightness.m_hasPendingRequest = false;
-        qDebug() << "setMonitorBrightness: finish";
-        if (m_brightness.m_hasWaitingRequest) {
-            QTimer::singleShot(0, this, &DisplayWorker::handleSetBrightnessRequest);
-        }
-        watcher->deleteLater();
-    });
-
-    QFuture<void> future = QtConcurrent::run([this] {
-        QMutexLocker loker(&m_brightness.m_brightnessMutex);
-        if (m_brightness.m_hasPendingRequest) {
-            return;
-        }
-        if (!m_brightness.m_hasWaitingRequest) {
-            return;
-        }
-        m_brightness.m_hasPendingRequest = true;
-        m_brightness.m_hasWaitingRequest = false;
-        QString name = m_brightness.m_monitorName;
-        double value = m_brightness.m_brightnessValue;
-        m_brightness.m_monitorName = "";
-        m_brightness.m_brightnessValue = 0;
-        loker.unlock();
-        qDebug() << "setMonitorBrightness: begin, " << name << value;
-        m_displayInter.SetAndSaveBrightness(name, value).waitForFinished();
-    });
-
-    watcher->setFuture(future);
+    m_brightnessToSave.clear();
 }
 
 void DisplayWorker::setMonitorPosition(QHash<Monitor *, QPair<int, int>> monitorPosition)
 {
+    // 新的拖动结果到达时，之前的事务不再触发 ApplyChanges；位置调用按顺序到达后端，以最后一次为准
+    if (m_layoutTransaction) {
+        m_layoutTransaction->cancel();
+        m_layoutTransaction->deleteLater();
+    }
+
+    m_layoutTransaction = new LayoutTransaction(this);
     for (auto it(monitorPosition.cbegin()); it != monitorPosition.cend(); ++it) {
         MonitorInter *inter = m_monitors.value(it.key());
         Q_ASSERT(inter);
-        inter->SetPosition(static_cast<short>(it.value().first), static_cast<short>(it.value().second)).waitForFinished();
+        m_layoutTransaction->setPosition(inter, it.value().first, it.value().second);
     }
-    applyChanges();
+
+    connect(m_layoutTransaction, &LayoutTransaction::finished, this, [this](bool success) {
+        m_layoutTransaction->deleteLater();
+        m_layoutTransaction = nullptr;
+        if (success)
+            applyChanges();
+    });
+    m_layoutTransaction->submit();
 }
 
 void DisplayWorker::setUiScale(const double value)
@@ -366,9 +383,8 @@ void DisplayWorker::setNightMode(const bool nightmode)
     process->start("bash", QStringList() << "-c" << QString("systemctl --user %1 redshift.service && systemctl --user %2 redshift.service").arg(serverCmd).arg(cmd));
 }
 
-void DisplayWorker::monitorAdded(const QString &path)
+void DisplayWorker::monitorAdded(MonitorInter *inter, const DBusPropertySnapshot &snapshot, bool canBrightness)
 {
-    MonitorInter *inter = new MonitorInter(DisplayInterface, path, QDBusConnection::sessionBus(), this);
     Monitor *mon = new Monitor(this);
 
     connect(inter, &MonitorInter::XChanged, mon, &Monitor::setX);
@@ -404,30 +420,27 @@ void DisplayWorker::monitorAdded(const QString &path)
     connect(inter, &MonitorInter::AvailableFillModesChanged, mon, &Monitor::setAvailableFillModes);
     connect(inter, &MonitorInter::CurrentFillModeChanged, mon, &Monitor::setCurrentFillMode);
     connect(this, &DisplayWorker::requestUpdateModeList, this, [=] {
-        mon->setModeList(inter->modes());
+        mon->setModeList(DBusProxyRegistry::syncRead(inter, &MonitorInter::modes));
     });
 
-    // NOTE: DO NOT using async dbus call. because we need to have a unique name to distinguish each monitor
-    Q_ASSERT(inter->isValid());
-    mon->setName(inter->name());
-    mon->setManufacturer(inter->manufacturer());
-    mon->setModel(inter->model());
-    QDBusReply<bool> reply = m_displayDBusInter->call("CanSetBrightness", inter->name());
-    mon->setCanBrightness(reply.value());
-    mon->setMonitorEnable(inter->enabled());
-    mon->setCurrentRotateMode(inter->currentRotateMode());
-    mon->setMonitorEnable(inter->enabled());
-    mon->setCurrentFillMode(inter->currentFillMode());
-    mon->setAvailableFillModes(inter->availableFillModes());
-    mon->setPath(path);
-    mon->setX(inter->x());
-    mon->setY(inter->y());
-    mon->setW(inter->width());
-    mon->setH(inter->height());
-    mon->setRotate(inter->rotation());
-    mon->setCurrentMode(inter->currentMode());
-    mon->setBestMode(inter->bestMode());
-    mon->setModeList(inter->modes());
+    // NOTE: 屏幕名称用于区分各个屏幕，必须在加入 model 前从快照中取得
+    mon->setName(snapshot.value<QString>("Name"));
+    mon->setManufacturer(snapshot.value<QString>("Manufacturer"));
+    mon->setModel(snapshot.value<QString>("Model"));
+    mon->setCanBrightness(canBrightness);
+    mon->setMonitorEnable(snapshot.value<bool>("Enabled"));
+    mon->setCurrentRotateMode(snapshot.value<uchar>("CurrentRotateMode"));
+    mon->setCurrentFillMode(snapshot.value<QString>("CurrentFillMode"));
+    mon->setAvailableFillModes(snapshot.value<QStringList>("AvailableFillModes"));
+    mon->setPath(inter->path());
+    mon->setX(snapshot.value<int>("X"));
+    mon->setY(snapshot.value<int>("Y"));
+    mon->setW(snapshot.value<int>("Width"));
+    mon->setH(snapshot.value<int>("Height"));
+    mon->setRotate(snapshot.value<quint16>("Rotation"));
+    mon->setCurrentMode(snapshot.value<Resolution>("CurrentMode"));
+    mon->setBestMode(snapshot.value<Resolution>("BestMode"));
+    mon->setModeList(snapshot.value<ResolutionList>("Modes"));
     if (m_model->isRefreshRateEnable() == false) {
         for (auto resolutionModel : mon->modeList()) {
             if (qFuzzyCompare(resolutionModel.rate(), 0.0) == false) {
@@ -435,10 +448,10 @@ void DisplayWorker::monitorAdded(const QString &path)
             }
         }
     }
-    mon->setRotateList(inter->rotations());
+    mon->setRotateList(snapshot.value<QList<quint16>>("Rotations"));
     mon->setPrimary(m_displayInter.primary());
-    mon->setMmWidth(inter->mmWidth());
-    mon->setMmHeight(inter->mmHeight());
+    mon->setMmWidth(snapshot.value<uint>("MmWidth"));
+    mon->setMmHeight(snapshot.value<uint>("MmHeight"));
 
     if (!m_model->brightnessMap().isEmpty()) {
         mon->setBrightness(m_model->brightnessMap()[mon->name()]);
@@ -446,12 +459,20 @@ void DisplayWorker::monitorAdded(const QString &path)
 
     m_model->monitorAdded(mon);
     m_monitors.insert(mon, inter);
-
-    inter->setSync(false);
 }
 
 void DisplayWorker::monitorRemoved(const QString &path)
 {
+    for (auto *bringUp : m_pendingMonitors) {
+        if (bringUp->path() == path) {
+            m_pendingMonitors.removeOne(bringUp);
+            bringUp->deleteLater();
+            // 被移除的屏幕可能挡住了后面已就绪的屏幕
+            publishPendingMonitors();
+            return;
+        }
+    }
+
     Monitor *monitor = nullptr;
     for (auto it(m_monitors.cbegin()); it != m_monitors.cend(); ++it) {
         if (it.key()->path() == path) {
@@ -464,6 +485,11 @@ void DisplayWorker::monitorRemoved(const QString &path)
 
     m_model->monitorRemoved(monitor);
 
+    if (CoalescingSetter *setter = m_brightnessSetters.take(monitor->name()))
+        setter->deleteLater();
+    // 被拔出的屏幕不再保存亮度
+    m_brightnessToSave.remove(monitor->name());
+
     m_monitors[monitor]->deleteLater();
     m_monitors.remove(monitor);
 
@@ -6,16 +6,20 @@
 #define DISPLAYWORKER_H
 
 #include "monitor.h"
+#include "layouttransaction.h"
+#include "monitorbringup.h"
+#include "modules/coalescingsetter.h"
+#include "modules/dbuspropertysnapshot.h"
+#include "modules/dbusproxyregistry.h"
 
 #include <QObject>
+#include <QPointer>
 
 #include <com_deepin_daemon_display.h>
 #include <com_deepin_daemon_appearance.h>
 #include <com_deepin_daemon_power.h>
 
 #include <QGSettings>
-#include <QMutex>
-#include <QMutexLocker>
 
 using DisplayInter = com::deepin::daemon::Display;
 using AppearanceInter = com::deepin::daemon::Appearance;
@@ -66,32 +70,32 @@ private Q_SLOTS:
     void onGetScreenScalesFinished(QDBusPendingCallWatcher *w);
 
 private:
-    void monitorAdded(const QString &path);
+    void publishPendingMonitors();
+    void monitorAdded(MonitorInter *inter, const DBusPropertySnapshot &snapshot, bool canBrightness);
     void monitorRemoved(const QString &path);
-    void handleSetBrightnessRequest();
+    void saveBrightness();
 
 Q_SIGNALS:
     void requestUpdateModeList();
+    // applyChanges 延时下发的 ApplyChanges 调用已返回
+    void changesApplied();
 
 private:
     DisplayModel *m_model;
     DisplayInter m_displayInter;
-    QDBusInterface *m_displayDBusInter;
     QGSettings *m_dccSettings;
-    AppearanceInter *m_appearanceInter;
+    SharedDBusProxy<AppearanceInter> m_appearanceInter;
     QMap<Monitor *, MonitorInter *> m_monitors;
+    QList<MonitorBringUp *> m_pendingMonitors;
     double m_currentScale;
     bool m_updateScale;
     QTimer *m_timer;
 
-    PowerInter *m_powerInter;
-    struct {
-        QMutex  m_brightnessMutex;
-        bool    m_hasPendingRequest = false;
-        bool    m_hasWaitingRequest = false;
-        double  m_brightnessValue = 0;
-        QString m_monitorName;
-    }m_brightness;
+    SharedDBusProxy<PowerInter> m_powerInter;
+    QHash<QString, CoalescingSetter *> m_brightnessSetters;
+    QMap<QString, double> m_brightnessToSave;
+    QTimer *m_brightnessSaveTimer;
+    QPointer<LayoutTransaction> m_layoutTransaction;
 };
 
 } // namespace display
@@ -0,0 +1,63 @@
+// SPDX-FileCopyrightText: 2022 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include "layouttransaction.h"
+
+#include <QDBusPendingCallWatcher>
+#include <QDebug>
+
+using namespace dcc::display;
+
+LayoutTransaction::LayoutTransaction(QObject *parent)
+    : QObject(parent)
+    , m_remaining(0)
+    , m_cancelled(false)
+{
+}
+
+void LayoutTransaction::setPosition(MonitorInter *inter, int x, int y)
+{
+    Q_ASSERT(inter);
+    m_positions << qMakePair(inter, QPoint(x, y));
+}
+
+void LayoutTransaction::submit()
+{
+    Q_ASSERT(!isRunning());
+
+    m_errors.clear();
+    m_remaining = m_positions.size();
+    if (m_remaining == 0) {
+        Q_EMIT finished(true);
+        return;
+    }
+
+    for (const auto &position : m_positions) {
+        const QPoint &pos = position.second;
+        QDBusPendingCall call = position.first->SetPosition(static_cast<short>(pos.x()), static_cast<short>(pos.y()));
+        QDBusPendingCallWatcher *watcher = new QDBusPendingCallWatcher(call, this);
+        connect(watcher, &QDBusPendingCallWatcher::finished, this, &LayoutTransaction::onCallFinished);
+    }
+}
+
+void LayoutTransaction::cancel()
+{
+    m_cancelled = true;
+}
+
+void LayoutTransaction::onCallFinished(QDBusPendingCallWatcher *watcher)
+{
+    watcher->deleteLater();
+
+    if (watcher->isError())
+        m_errors << watcher->error();
+
+    if (--m_remaining > 0 || m_cancelled)
+        return;
+
+    for (const QDBusError &error : m_errors)
+        qWarning() << "SetPosition failed:" << error.message();
+
+    Q_EMIT finished(m_errors.isEmpty());
+}
@@ -0,0 +1,55 @@
+// SPDX-FileCopyrightText: 2022 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#ifndef LAYOUTTRANSACTION_H
+#define LAYOUTTRANSACTION_H
+
+#include "monitor.h"
+
+#include <QDBusError>
+#include <QObject>
+#include <QPoint>
+
+class QDBusPendingCallWatcher;
+
+namespace dcc {
+
+namespace display {
+
+// 多屏位置调整事务
+// 所有屏幕的 SetPosition 一次性异步发出，全部返回后只发出一次 finished；
+// 被新的拖动结果取代时调用 cancel，已发出的调用照常执行，但不再上报结果
+class LayoutTransaction : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit LayoutTransaction(QObject *parent = nullptr);
+
+    void setPosition(MonitorInter *inter, int x, int y);
+    void submit();
+    void cancel();
+
+    bool isRunning() const { return m_remaining > 0; }
+    const QList<QDBusError> &errors() const { return m_errors; }
+
+Q_SIGNALS:
+    // success 为 false 时 errors() 中是失败调用的错误
+    void finished(bool success);
+
+private:
+    void onCallFinished(QDBusPendingCallWatcher *watcher);
+
+private:
+    QList<QPair<MonitorInter *, QPoint>> m_positions;
+    QList<QDBusError> m_errors;
+    int m_remaining;
+    bool m_cancelled;
+};
+
+} // namespace display
+
+} // namespace dcc
+
+#endif // LAYOUTTRANSACTION_H
@@ -0,0 +1,103 @@
+// SPDX-FileCopyrightText: 2022 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include "monitorbringup.h"
+
+#include <QDBusPendingCallWatcher>
+#include <QDBusPendingReply>
+#include <QDebug>
+
+#include <algorithm>
+
+using namespace dcc;
+using namespace dcc::display;
+
+MonitorBringUp::MonitorBringUp(const QString &service, const QString &path, QObject *parent)
+    : QObject(parent)
+    , m_service(service)
+    , m_path(path)
+    , m_inter(new MonitorInter(service, path, QDBusConnection::sessionBus(), this))
+    , m_properties(new DBusPropertySnapshot(m_inter, this))
+    , m_canBrightness(false)
+    , m_state(Idle)
+    , m_stageStarted(0)
+    , m_totalElapsed(-1)
+{
+    std::fill(m_stageElapsed, m_stageElapsed + StageCount, -1);
+
+    m_inter->setSync(false);
+
+    connect(m_properties, &DBusPropertySnapshot::ready, this, &MonitorBringUp::onPropertiesReady);
+    connect(m_properties, &DBusPropertySnapshot::failed, this, [this](const QDBusError &error) {
+        fail(error.message());
+    });
+}
+
+void MonitorBringUp::start()
+{
+    if (m_state != Idle)
+        return;
+
+    m_state = Running;
+    m_timer.start();
+    m_stageStarted = 0;
+    m_properties->fetch();
+}
+
+MonitorInter *MonitorBringUp::takeInter(QObject *parent)
+{
+    MonitorInter *inter = m_inter;
+    m_inter = nullptr;
+    if (inter)
+        inter->setParent(parent);
+
+    return inter;
+}
+
+void MonitorBringUp::onPropertiesReady()
+{
+    finishStage(Properties);
+
+    // 屏幕名称只能从属性中取得，亮度能力的查询排在属性之后
+    QDBusMessage msg = QDBusMessage::createMethodCall(m_service, "/com/deepin/daemon/Display", m_service, "CanSetBrightness");
+    msg << m_properties->value<QString>("Name");
+
+    QDBusPendingCallWatcher *watcher = new QDBusPendingCallWatcher(QDBusConnection::sessionBus().asyncCall(msg), this);
+    connect(watcher, &QDBusPendingCallWatcher::finished, this, &MonitorBringUp::onBrightnessFinished);
+}
+
+void MonitorBringUp::onBrightnessFinished(QDBusPendingCallWatcher *watcher)
+{
+    watcher->deleteLater();
+
+    QDBusPendingReply<bool> reply = *watcher;
+    // 查询失败不影响屏幕的使用，按不支持调节亮度处理
+    if (reply.isError())
+        qWarning() << "CanSetBrightness failed for" << m_path << reply.error().message();
+    else
+        m_canBrightness = reply.value();
+
+    finishStage(Brightness);
+
+    m_state = Ready;
+    m_totalElapsed = m_timer.elapsed();
+    qDebug() << "monitor" << m_path << "ready in" << m_totalElapsed << "ms, properties:"
+             << m_stageElapsed[Properties] << "ms, brightness:" << m_stageElapsed[Brightness] << "ms";
+    Q_EMIT ready();
+}
+
+void MonitorBringUp::finishStage(Stage stage)
+{
+    const qint64 now = m_timer.elapsed();
+    m_stageElapsed[stage] = now - m_stageStarted;
+    m_stageStarted = now;
+}
+
+void MonitorBringUp::fail(const QString &reason)
+{
+    m_state = Failed;
+    m_totalElapsed = m_timer.elapsed();
+    qWarning() << "monitor" << m_path << "bring-up failed after" << m_totalElapsed << "ms:" << reason;
+    Q_EMIT failed();
+}
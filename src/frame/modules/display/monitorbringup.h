@@ -0,0 +1,85 @@
+// SPDX-FileCopyrightText: 2022 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#ifndef MONITORBRINGUP_H
+#define MONITORBRINGUP_H
+
+#include "monitor.h"
+#include "modules/dbuspropertysnapshot.h"
+
+#include <QElapsedTimer>
+#include <QObject>
+
+class QDBusPendingCallWatcher;
+
+namespace dcc {
+
+namespace display {
+
+// 新接入屏幕的异步初始化流程
+// Properties：一次 GetAll 取回屏幕的全部属性
+// Brightness：属性就绪后按屏幕名称查询 CanSetBrightness
+// 全部阶段完成后发出 ready，失败时发出 failed；各阶段耗时可通过 stageElapsed 获取
+class MonitorBringUp : public QObject
+{
+    Q_OBJECT
+
+public:
+    enum Stage {
+        Properties,
+        Brightness,
+        StageCount
+    };
+
+    enum State {
+        Idle,
+        Running,
+        Ready,
+        Failed
+    };
+
+    explicit MonitorBringUp(const QString &service, const QString &path, QObject *parent = nullptr);
+
+    void start();
+
+    inline State state() const { return m_state; }
+    inline QString path() const { return m_path; }
+    inline const DBusPropertySnapshot &properties() const { return *m_properties; }
+    inline bool canBrightness() const { return m_canBrightness; }
+    // 阶段未完成时返回 -1
+    inline qint64 stageElapsed(Stage stage) const { return m_stageElapsed[stage]; }
+    inline qint64 totalElapsed() const { return m_totalElapsed; }
+
+    // 转移屏幕代理的所有权，之后由调用方负责释放
+    MonitorInter *takeInter(QObject *parent);
+
+Q_SIGNALS:
+    void ready();
+    void failed();
+
+private:
+    void onPropertiesReady();
+    void onBrightnessFinished(QDBusPendingCallWatcher *watcher);
+    void finishStage(Stage stage);
+    void fail(const QString &reason);
+
+private:
+    QString m_service;
+    QString m_path;
+    MonitorInter *m_inter;
+    DBusPropertySnapshot *m_properties;
+    bool m_canBrightness;
+
+    State m_state;
+    QElapsedTimer m_timer;
+    qint64 m_stageElapsed[StageCount];
+    qint64 m_stageStarted;
+    qint64 m_totalElapsed;
+};
+
+} // namespace display
+
+} // namespace dcc
+
+#endif // MONITORBRINGUP_H
@@ -0,0 +1,178 @@
+// SPDX-FileCopyrightText: 2022 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include "monitorlayoutengine.h"
+
+#include <QLineF>
+
+#include <algorithm>
+#include <numeric>
+
+using namespace dcc::display;
+
+// 边界相接也算相交，与 QPolygonF::intersects 的判断一致
+static bool touches(const QRectF &r1, const QRectF &r2)
+{
+    return r1.left() <= r2.right() && r2.left() <= r1.right()
+            && r1.top() <= r2.bottom() && r2.top() <= r1.bottom();
+}
+
+void MonitorLayoutEngine::setItems(const QVector<Item> &items)
+{
+    m_items = items;
+    m_adjacency = QVector<QVector<int>>(m_items.size());
+}
+
+void MonitorLayoutEngine::updateItem(int index, const Item &item)
+{
+    Q_ASSERT(index >= 0 && index < m_items.size());
+    m_items[index] = item;
+}
+
+bool MonitorLayoutEngine::rebuildAdjacency()
+{
+    const int n = m_items.size();
+    m_adjacency = QVector<QVector<int>>(n);
+
+    // 每个块在场景中可能影响到的范围
+    QVector<QRectF> spans(n);
+    for (int i = 0; i < n; ++i)
+        spans[i] = m_items[i].bounding.united(m_items[i].extended).united(m_items[i].inner);
+
+    QVector<int> order(n);
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&spans](int i, int j) {
+        return spans[i].left() < spans[j].left();
+    });
+
+    bool overlapped = false;
+    auto link = [&](int from, int to) {
+        const QRectF &target = m_items[to].bounding;
+        if (m_items[from].inner.intersects(target))
+            overlapped = true;
+        else if (m_items[from].extended.intersects(target))
+            m_adjacency[from].append(to);
+    };
+
+    // 按左边界扫描，只比较 x 方向区间仍有交集的块
+    QVector<int> active;
+    for (int i : order) {
+        const qreal left = spans[i].left();
+        active.erase(std::remove_if(active.begin(), active.end(), [&spans, left](int j) {
+            return spans[j].right() < left;
+        }), active.end());
+
+        for (int j : active) {
+            link(i, j);
+            link(j, i);
+        }
+        active.append(i);
+    }
+
+    for (auto &neighbors : m_adjacency)
+        std::sort(neighbors.begin(), neighbors.end());
+
+    return overlapped;
+}
+
+QVector<int> MonitorLayoutEngine::connectedDomain(int index) const
+{
+    QVector<int> domain;
+    if (index < 0 || index >= m_items.size())
+        return domain;
+
+    QVector<bool> visited(m_items.size(), false);
+    visited[index] = true;
+
+    QVector<int> queue { index };
+    for (int head = 0; head < queue.size(); ++head) {
+        for (int next : m_adjacency[queue[head]]) {
+            if (visited[next])
+                continue;
+
+            visited[next] = true;
+            queue.append(next);
+            domain.append(next);
+        }
+    }
+
+    domain.append(index);
+    return domain;
+}
+
+QVector<QVector<int>> MonitorLayoutEngine::connectedDomains() const
+{
+    QVector<QVector<int>> domains;
+    QVector<bool> visited(m_items.size(), false);
+
+    for (int i = 0; i < m_items.size(); ++i) {
+        if (visited[i])
+            continue;
+
+        visited[i] = true;
+        QVector<int> domain { i };
+        for (int head = 0; head < domain.size(); ++head) {
+            for (int next : m_adjacency[domain[head]]) {
+                if (!visited[next]) {
+                    visited[next] = true;
+                    domain.append(next);
+                }
+            }
+        }
+        domains.append(domain);
+    }
+
+    return domains;
+}
+
+bool MonitorLayoutEngine::isFullyConnected() const
+{
+    return m_items.isEmpty() || connectedDomain(0).size() == m_items.size();
+}
+
+MonitorLayoutEngine::MoveAnalysis MonitorLayoutEngine::analyzeMove(int moving, const QVector<int> &others) const
+{
+    MoveAnalysis result;
+    const Item &mover = m_items[moving];
+    const QPointF center = mover.bounding.center();
+    qreal intersectedArea = 0.0;
+
+    for (int i : others) {
+        if (i == moving)
+            continue;
+
+        const QRectF &target = m_items[i].bounding;
+        result.byDistance.append(qMakePair(i, QLineF(center, target.center()).length()));
+
+        // 不相接的块不会覆盖、吸附或重叠
+        if (!touches(mover.bounding, target) && !touches(mover.inner, target))
+            continue;
+
+        const QRectF rect = mover.inner.intersected(target);
+        intersectedArea += rect.width() * rect.height();
+
+        //1、移动块完全覆盖一个块 2、移动块与另外一个块十字相交时 执行自动回弹操作
+        if (mover.bounding.contains(target)
+                || (rect.top() < mover.inner.top() && rect.bottom() > mover.inner.bottom() && qFuzzyCompare(rect.left(), mover.inner.left()) && qFuzzyCompare(rect.right(), mover.inner.right()))
+                || (rect.right() < mover.inner.right() && rect.left() > mover.inner.left() && qFuzzyCompare(rect.top(), mover.inner.top()) && qFuzzyCompare(rect.bottom(), mover.inner.bottom()))) {
+            result.shelters.append(i);
+        }
+
+        //要么不相交,要相交就是要点线相交的
+        const bool boundingTouched = touches(mover.bounding, target);
+        if (boundingTouched && !touches(mover.inner, target))
+            result.adsorbed = true;
+        if (boundingTouched && touches(mover.inner, target))
+            result.intersected = true;
+    }
+
+    //移动块被完全包含在其他的块
+    result.covered = qFuzzyCompare(mover.inner.width() * mover.inner.height(), intersectedArea);
+
+    std::stable_sort(result.byDistance.begin(), result.byDistance.end(), [](const QPair<int, qreal> &item1, const QPair<int, qreal> &item2) {
+        return item1.second < item2.second;
+    });
+
+    return result;
+}
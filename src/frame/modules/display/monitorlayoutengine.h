@@ -0,0 +1,68 @@
+// SPDX-FileCopyrightText: 2022 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#ifndef MONITORLAYOUTENGINE_H
+#define MONITORLAYOUTENGINE_H
+
+#include <QPair>
+#include <QRectF>
+#include <QVector>
+
+namespace dcc {
+
+namespace display {
+
+// 多屏拼接的布局计算，不依赖任何控件，可以脱离界面单独测试和压测
+// 屏幕块用下标表示，矩形均为场景坐标：
+//   bounding - 屏幕块本身
+//   extended - 向外扩展的吸附范围，与其他块相交视为相邻
+//   inner    - 向内收缩的范围，与其他块相交视为重叠
+//
+// 相邻关系按 x 方向的区间排序后扫描求出，只比较区间有交集的块，
+// 连通域用邻接表做广度优先搜索
+class MonitorLayoutEngine
+{
+public:
+    struct Item {
+        QRectF bounding;
+        QRectF extended;
+        QRectF inner;
+    };
+
+    // 被移动块与其他块的位置关系，对应拼接算法的第一步
+    struct MoveAnalysis {
+        QVector<int> shelters;                 // 被移动块完全覆盖或十字相交的块
+        bool covered = false;                  // 被移动块被其他块完全覆盖
+        bool adsorbed = false;                 // 存在只在边缘相接的块
+        bool intersected = false;              // 存在重叠的块
+        QVector<QPair<int, qreal>> byDistance; // 按中心点距离从近到远排列的其他块
+    };
+
+    void setItems(const QVector<Item> &items);
+    void updateItem(int index, const Item &item);
+    inline int count() const { return m_items.size(); }
+    inline const Item &item(int index) const { return m_items[index]; }
+
+    // 重新计算相邻关系，返回是否存在重叠的块
+    bool rebuildAdjacency();
+    inline const QVector<int> &neighbors(int index) const { return m_adjacency[index]; }
+
+    // index 所在的连通域，index 排在最后，其余按搜索顺序排列
+    QVector<int> connectedDomain(int index) const;
+    // 所有连通域，按各域中最小的下标排序
+    QVector<QVector<int>> connectedDomains() const;
+    bool isFullyConnected() const;
+
+    MoveAnalysis analyzeMove(int moving, const QVector<int> &others) const;
+
+private:
+    QVector<Item> m_items;
+    QVector<QVector<int>> m_adjacency;
+};
+
+} // namespace display
+
+} // namespace dcc
+
+#endif // MONITORLAYOUTENGINE_H
@@ -0,0 +1,40 @@
+// SPDX-FileCopyrightText: 2022 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include "monitormodetable.h"
+
+using namespace dcc::display;
+
+MonitorModeTable::ModeKey MonitorModeTable::modeKey(const Resolution &r)
+{
+    return qMakePair(resolutionKey(r), QString::number(r.rate(), 'g', 4));
+}
+
+void MonitorModeTable::rebuild(const QList<Resolution> &modes)
+{
+    m_resolutions.clear();
+    m_modesByResolution.clear();
+    m_resolutionKeys.clear();
+    m_modeKeys.clear();
+    m_modesById.clear();
+
+    for (const auto &mode : modes) {
+        auto it = m_modesByResolution.find(resolutionKey(mode));
+        if (it == m_modesByResolution.end()) {
+            m_resolutions.append(mode);
+            m_resolutionKeys.insert(resolutionKey(mode));
+            it = m_modesByResolution.insert(resolutionKey(mode), QList<Resolution>());
+        }
+        it->append(mode);
+
+        m_modeKeys.insert(modeKey(mode));
+        m_modesById.insert(mode.id(), mode);
+    }
+}
+
+bool MonitorModeTable::contains(const Resolution &mode) const
+{
+    auto it = m_modesById.constFind(mode.id());
+    return it != m_modesById.cend() && it.value() == mode;
+}
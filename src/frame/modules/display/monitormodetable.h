@@ -0,0 +1,60 @@
+// SPDX-FileCopyrightText: 2022 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#ifndef MONITORMODETABLE_H
+#define MONITORMODETABLE_H
+
+#include "monitor.h"
+
+#include <QHash>
+#include <QPair>
+#include <QSet>
+
+namespace dcc {
+
+namespace display {
+
+// 单个屏幕模式列表的索引，模式列表变化时整体重建
+// 分辨率按宽高比较，刷新率按 4 位有效数字比较，与 Monitor::isSameResolution/isSameRatefresh 一致
+class MonitorModeTable
+{
+public:
+    using ResolutionKey = quint64;
+    using ModeKey = QPair<ResolutionKey, QString>;
+
+    static inline ResolutionKey resolutionKey(int width, int height)
+    {
+        return (static_cast<quint64>(static_cast<quint32>(width)) << 32) | static_cast<quint32>(height);
+    }
+    static inline ResolutionKey resolutionKey(const Resolution &r) { return resolutionKey(r.width(), r.height()); }
+    static ModeKey modeKey(const Resolution &r);
+
+    void rebuild(const QList<Resolution> &modes);
+
+    // 去重后的分辨率，保持模式列表中的顺序，每个分辨率取第一个模式
+    inline const QList<Resolution> &resolutions() const { return m_resolutions; }
+    // 指定分辨率下的全部模式，保持模式列表中的顺序
+    inline QList<Resolution> modes(int width, int height) const { return m_modesByResolution.value(resolutionKey(width, height)); }
+    inline QList<Resolution> modes(const Resolution &resolution) const { return modes(resolution.width(), resolution.height()); }
+
+    inline bool hasResolution(const Resolution &r) const { return m_modesByResolution.contains(resolutionKey(r)); }
+    inline bool hasResolutionAndRate(const Resolution &r) const { return m_modeKeys.contains(modeKey(r)); }
+    bool contains(const Resolution &mode) const;
+
+    inline const QSet<ResolutionKey> &resolutionKeys() const { return m_resolutionKeys; }
+    inline const QSet<ModeKey> &modeKeys() const { return m_modeKeys; }
+
+private:
+    QList<Resolution> m_resolutions;
+    QHash<ResolutionKey, QList<Resolution>> m_modesByResolution;
+    QSet<ResolutionKey> m_resolutionKeys;
+    QSet<ModeKey> m_modeKeys;
+    QHash<quint32, Resolution> m_modesById;
+};
+
+} // namespace display
+
+} // namespace dcc
+
+#endif // MONITORMODETABLE_H
@@ -448,73 +448,33 @@ QPointF MonitorsGround::multiScreenSortAlgo(bool &isRestore, const bool isReboun
     qreal g_dx = 0.0;
     qreal g_dy = 0.0;
 
-    qreal intersectedArea = 0.0; //相交的面积
-
-    QRectF moveItemIntersect, moveItemRect;
-
     bool g_bXYTogetherMoved = false; //标志XY方向是否一起移动，其余情况按哪个方向离得近向哪个方向移动
 
-
-    moveItemIntersect = m_movingItem->mapRectToScene(m_movingItem->justIntersectRect());
-    moveItemRect = m_movingItem->mapRectToScene(m_movingItem->boundingRect());
-
-    auto mapToSceneIntersectRect = [=](MonitorProxyWidget *item) {
-        return item->mapToScene(item->justIntersectRect());
-    };
-
-    auto mapToSceneBoundingRect = [=](MonitorProxyWidget *item) {
-        return item->mapToScene(item->boundingRect());
-    };
-
-
-    for (int i = 0; i < m_lstSortItems.size(); i++) {
-
-        if (m_movingItem != m_lstSortItems[i]) {
-            QRectF rect = moveItemIntersect.intersected(m_lstSortItems[i]->mapRectToScene(m_lstSortItems[i]->boundingRect()));
-            intersectedArea += rect.width()*rect.height();
-
-            qInfo() << "rect" << rect << "moveItemRect" << moveItemRect << "moveItemIntersect" << moveItemIntersect;
-
-            //1、移动块完全覆盖一个块 2、移动块与另外一个块十字相交时 执行自动回弹操作
-            if (moveItemRect.contains(m_lstSortItems[i]->mapRectToScene(m_lstSortItems[i]->boundingRect()))
-                    || (rect.top() < moveItemIntersect.top() && rect.bottom() > moveItemIntersect.bottom() && qFuzzyCompare(rect.left(), moveItemIntersect.left()) && qFuzzyCompare(rect.right(), moveItemIntersect.right()))
-                    || (rect.right() < moveItemIntersect.right() && rect.left() > moveItemIntersect.left() && qFuzzyCompare(rect.top(), moveItemIntersect.top()) && qFuzzyCompare(rect.bottom(), moveItemIntersect.bottom()))) {
-                lstShelterItems.append(m_lstSortItems[i]);
-            }
-
-            //要么不相交,要相交就是要点线相交的
-            if (!mapToSceneIntersectRect(m_movingItem).intersects(mapToSceneBoundingRect(m_lstSortItems[i]))
-               && mapToSceneBoundingRect(m_movingItem).intersects(mapToSceneBoundingRect(m_lstSortItems[i]))) {
-                isAutoAdsorption = true;
-            }
-            //出现相交的情况
-            if (mapToSceneIntersectRect(m_movingItem).intersects(mapToSceneBoundingRect(m_lstSortItems[i]))
-                    && mapToSceneBoundingRect(m_movingItem).intersects(mapToSceneBoundingRect(m_lstSortItems[i]))) {
-                isIntersect = true;
-            }
-
-            lstNoMovedItems.append(m_lstSortItems[i]);
+    //被移动块与其他块的覆盖、吸附、相交关系及中心点距离的排序由布局引擎计算
+    syncLayoutEngine();
+    QVector<int> others;
+    for (auto item : m_lstSortItems) {
+        if (m_movingItem != item) {
+            others.append(m_lstItems.indexOf(item));
+            lstNoMovedItems.append(item);
         }
     }
 
+    const MonitorLayoutEngine::MoveAnalysis analysis = m_layoutEngine.analyzeMove(m_lstItems.indexOf(m_movingItem), others);
+    for (int index : analysis.shelters)
+        lstShelterItems.append(m_lstItems[index]);
+    isAutoAdsorption = analysis.adsorbed;
+    isIntersect = analysis.intersected;
+
     //移动块被完全包含在其他的块
-    if (qFuzzyCompare(moveItemIntersect.width() * moveItemIntersect.height(), intersectedArea)) {
+    if (analysis.covered) {
         qDebug() << "存在包含关系";
         lstShelterItems.append(m_movingItem);
     }
 
-    //移动块到其他块中心点的距离排序
-    QPointF movedPos = m_movingItem->mapToScene(m_movingItem->boundingRect().center());
-    for (auto item : lstNoMovedItems) {
-        QPointF tempPos = item->mapToScene(item->boundingRect().center());
-        qreal len = sqrt(pow(tempPos.x()-movedPos.x(),2)+pow(tempPos.y()-movedPos.y(),2));
-        m_lstMoveingItemToCenterPosLen.append(qMakePair(item,len));
-    }
-
-    //获取距离最近的块
-    std::sort(m_lstMoveingItemToCenterPosLen.begin(),m_lstMoveingItemToCenterPosLen.end(),[=](const QPair<MonitorProxyWidget *, qreal> &item1, const QPair<MonitorProxyWidget *, qreal> &item2) {
-       return item1.second < item2.second;
-    });
+    //移动块到其他块中心点的距离，由近到远
+    for (const auto &pair : analysis.byDistance)
+        m_lstMoveingItemToCenterPosLen.append(qMakePair(m_lstItems[pair.first], pair.second));
 
     //自动回弹的触发条件: 1. 一个屏幕完全包含另一个屏的时候 2. 一个屏幕剩下的屏幕集合所包围
     if (lstShelterItems.size() > 0) {
@@ -1040,25 +1000,15 @@ void MonitorsGround::multiScreenAutoAdjust()
         return;
 
     QMap<MonitorProxyWidget *,QList<MonitorProxyWidget *>> maplstItems;
-    QMap<MonitorProxyWidget *, bool> mapItemsNeedMove;
-    QList<MonitorProxyWidget *> itemTemp;
 
     //这个列表是存放的就是所有移动块相关的块
     //判断改变连通的块与移动块的剩余联通块是否存在连接
     //【这种是在移动块初始连接块是两个及以上的情况下触发的，如果是一个连通块的话不会改变连通状态的】
 
-    //获取屏幕集群
-    for (auto iter : m_lstItems) {
-
-        if (!lstChangedItems.contains(iter))
-            continue;
-
-        itemTemp = getConnectedDomain(iter);
-        for (auto k : itemTemp) {
-            if (lstChangedItems.contains(k) && k != iter) {
-                lstChangedItems.removeOne(k);
-            }
-        }
+    //获取屏幕集群，每个集群取在 m_lstItems 中最靠前的块作为代表
+    lstChangedItems.clear();
+    for (const auto &domain : m_layoutEngine.connectedDomains()) {
+        lstChangedItems.append(m_lstItems[domain.first()]);
     }
 
     for (auto item : lstChangedItems) {
@@ -1115,27 +1065,20 @@ void MonitorsGround::multiScreenAutoAdjust()
 //更新上一次拼接完成的值
 bool MonitorsGround::updateConnectedState(bool isInit)
 {
-    bool isIntersect = false;
-    QList<MonitorProxyWidget *> m_lstItemsTemp;
-    for (int i = 0; i < m_lstItems.size(); i++) {
-        m_lstItemsTemp.clear();
+    syncLayoutEngine();
+    bool isIntersect = m_layoutEngine.rebuildAdjacency();
 
-        for (int j = 0; j < m_lstItems.size(); j++) {
-            if (j != i && m_lstItems[i]->mapRectToScene(m_lstItems[i]->boundingRectEx()).intersects(m_lstItems[j]->mapRectToScene(m_lstItems[j]->boundingRect()))
-                   && !m_lstItemsTemp.contains(m_lstItems[j])
-                   && !m_lstItems[i]->mapRectToScene(m_lstItems[i]->justIntersectRect()).intersects(m_lstItems[j]->mapRectToScene(m_lstItems[j]->boundingRect()))) {
-                m_lstItemsTemp.append(m_lstItems[j]);
-            }
-            if (j != i && m_lstItems[i]->mapRectToScene(m_lstItems[i]->justIntersectRect()).intersects(m_lstItems[j]->mapRectToScene(m_lstItems[j]->boundingRect()))) {
-                isIntersect = true;
-            }
+    for (int i = 0; i < m_lstItems.size(); i++) {
+        QList<MonitorProxyWidget *> lstItemsTemp;
+        for (int index : m_layoutEngine.neighbors(i)) {
+            lstItemsTemp.append(m_lstItems[index]);
         }
 
         if (isInit) {
-            m_mapInitItemConnectedState.insert(m_lstItems[i],m_lstItemsTemp);
+            m_mapInitItemConnectedState.insert(m_lstItems[i], lstItemsTemp);
         }
 
-        m_mapItemConnectedState.insert(m_lstItems[i],m_lstItemsTemp);
+        m_mapItemConnectedState.insert(m_lstItems[i], lstItemsTemp);
     }
 
     return isIntersect;
@@ -1144,41 +1087,33 @@ bool MonitorsGround::updateConnectedState(bool isInit)
 //获取连通域
 QList<MonitorProxyWidget *> MonitorsGround::getConnectedDomain(MonitorProxyWidget *item)
 {
-   QList<MonitorProxyWidget *> lstTemp1Items;
-
-   QList<MonitorProxyWidget *> lstTemp;
-   QList<MonitorProxyWidget *> lstItems;
-
-   lstItems.append(item);
-
-   for (auto iter : m_lstItems) /*标记循环次数*/ {
-       Q_UNUSED(iter)
-
-       lstTemp.clear();
-       //获取所有的value
-       for (auto a : lstItems) {
-           for (auto t : m_mapItemConnectedState[a]) {
-               if (!lstTemp1Items.contains(t))
-                   lstTemp.append(t);
-           }
-       }
+    QList<MonitorProxyWidget *> lstItems;
+    for (int index : m_layoutEngine.connectedDomain(m_lstItems.indexOf(item))) {
+        lstItems.append(m_lstItems[index]);
+    }
 
-       //去重插入
-       for (auto t : lstTemp) {
-           if (!lstTemp1Items.contains(t) && t != item)
-               lstTemp1Items.append(t);
-           else {
-               lstTemp.removeOne(t);
-           }
-       }
+    return lstItems;
+}
 
-       lstItems.clear();
-       lstItems.append(lstTemp);
-   }
+//将各屏幕块当前在场景中的位置同步到布局引擎
+void MonitorsGround::syncLayoutEngine()
+{
+    QVector<MonitorLayoutEngine::Item> items;
+    items.reserve(m_lstItems.size());
+    for (auto item : m_lstItems) {
+        items.append({ item->mapRectToScene(item->boundingRect()),
+                       item->mapRectToScene(item->boundingRectEx()),
+                       item->mapRectToScene(item->justIntersectRect()) });
+    }
 
-    lstTemp1Items.append(item);
+    if (items.size() != m_layoutEngine.count()) {
+        m_layoutEngine.setItems(items);
+        return;
+    }
 
-    return lstTemp1Items;
+    for (int i = 0; i < items.size(); i++) {
+        m_layoutEngine.updateItem(i, items[i]);
+    }
 }
 
 
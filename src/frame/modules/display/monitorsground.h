@@ -6,6 +6,7 @@
 #define MONITORSGROUND_H
 
 #include "monitor.h"
+#include "monitorlayoutengine.h"
 
 #include <QWidget>
 #include <QGraphicsScene>
@@ -65,6 +66,7 @@ private:
     void multiScreenAutoAdjust(); // 手动调整完如果出现没有完全连通的情况，需要启动自动调整算法
     bool updateConnectedState(bool isInit = false); //更新连通状态
     QList<MonitorProxyWidget *> getConnectedDomain(MonitorProxyWidget *item); //获取每个屏幕的连通域
+    void syncLayoutEngine(); //同步屏幕块位置到布局引擎
     void updateScale();
     void singleScreenAdjest();//单屏幕调整
     void autoRebound(); //自动回弹流程
@@ -84,6 +86,7 @@ private:
     QList<QPair<MonitorProxyWidget *, qreal>> m_lstMoveingItemToCenterPosLen;           //所有块的中心点到移动点的距离
     QMap<MonitorProxyWidget *, QList<MonitorProxyWidget *>> m_mapItemConnectedState;    //所有块的实时连通状态
     QMap<MonitorProxyWidget *, QList<MonitorProxyWidget *>> m_mapInitItemConnectedState; //所有块的初始连通状态
+    MonitorLayoutEngine m_layoutEngine; //拼接、连通关系的计算
 
     QTimer *m_refershTimer;
     QTimer *m_effectiveTimer;
@@ -205,7 +205,7 @@ void keyboard::CustomEdit::onSaveAccels()
 
     m_info->name = m_name->text();
     m_info->command = m_command->text();
-    m_info->accels = m_short->text();
+    m_model->setAccels(m_info, m_short->text());
 
     Q_EMIT requestSaveShortcut(m_info);
 
@@ -161,6 +161,18 @@ void KeyboardModel::setRepeatInterval(const uint &repeatInterval)
 void KeyboardModel::setAllShortcut(const QMap<QStringList, int> &map)
 {
     m_shortcutMap = map;
+
+    m_shortcutKeys.clear();
+    m_shortcutKeys.reserve(map.size());
+    for (auto it = map.cbegin(); it != map.cend(); ++it) {
+        if (!it.key().isEmpty())
+            m_shortcutKeys.insert(qMakePair(it.value(), it.key().last()));
+    }
+}
+
+bool KeyboardModel::isShortcutOccupied(int modifiers, const QString &key) const
+{
+    return m_shortcutKeys.contains(qMakePair(modifiers, key));
 }
 
 bool KeyboardModel::numLock() const
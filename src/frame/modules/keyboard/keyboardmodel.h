@@ -8,6 +8,8 @@
 #include <QObject>
 #include <QStringList>
 #include <QMap>
+#include <QPair>
+#include <QSet>
 #include "indexmodel.h"
 
 
@@ -52,6 +54,8 @@ public:
     QList<MetaData> langLists() const;
     bool capsLock() const;
     QMap<QStringList, int> allShortcut() const;
+    // 修饰键组合为 modifiers、主键为 key 的快捷键是否已存在
+    bool isShortcutOccupied(int modifiers, const QString &key) const;
 
     uint repeatInterval() const;
     void setRepeatInterval(const uint &repeatInterval);
@@ -108,6 +112,7 @@ private:
     QMap<QString, QString> m_layouts;
     QList<MetaData> m_langList;
     QMap<QStringList, int> m_shortcutMap;
+    QSet<QPair<int, QString>> m_shortcutKeys; // (修饰键, 主键)，与 m_shortcutMap 同步
     int m_status{0};
 };
 }
@@ -5,6 +5,8 @@
 #include "keyboardwork.h"
 #include "shortcutitem.h"
 #include "keyboardmodel.h"
+#include "layoutcatalogue.h"
+#include "layoutsortkeys.h"
 #include <QTime>
 #include <QDebug>
 #include <QLocale>
@@ -12,6 +14,8 @@
 #include <QCoreApplication>
 #include <QGuiApplication>
 
+#include <algorithm>
+
 namespace dcc {
 namespace keyboard{
 
@@ -33,13 +37,17 @@ KeyboardWorker::KeyboardWorker(KeyboardModel *model, QObject *parent)
                                           "/com/deepin/daemon/Keybinding",
                                           QDBusConnection::sessionBus(), this))
      , m_wm(new WM("com.deepin.wm", "/com/deepin/wm", QDBusConnection::sessionBus(), this))
+#ifndef DCC_DISABLE_KBLAYOUT
+     , m_layoutCatalogue(new LayoutCatalogue(m_keyboardInter, this))
+#endif
 {
     connect(m_wm, &WM::compositingEnabledChanged, this, &KeyboardWorker::onGetWindowWM);
     connect(m_keybindInter, SIGNAL(Added(QString,int)), this,SLOT(onAdded(QString,int)));
-    connect(m_keybindInter, &KeybingdingInter::Deleted, this, &KeyboardWorker::removed);
+    connect(m_keybindInter, &KeybingdingInter::Deleted, this, &KeyboardWorker::onShortcutDeleted);
 #ifndef DCC_DISABLE_KBLAYOUT
     connect(m_keyboardInter, &KeyboardInter::UserLayoutListChanged, this, &KeyboardWorker::onUserLayout);
     connect(m_keyboardInter, &KeyboardInter::CurrentLayoutChanged, this, &KeyboardWorker::onCurrentLayout);
+    connect(m_layoutCatalogue, &LayoutCatalogue::loadFinished, this, &KeyboardWorker::onLayoutCatalogueLoaded);
 #endif
     connect(m_keyboardInter, SIGNAL(CapslockToggleChanged(bool)), m_model, SLOT(setCapsLock(bool)));
     connect(m_keybindInter, &KeybingdingInter::NumLockStateChanged, m_model, &KeyboardModel::setNumLock);
@@ -174,25 +182,17 @@ bool KeyboardWorker::keyOccupy(const QStringList &list)
             continue;
     }
 
-    QMap<QStringList,int> keylist = m_model->allShortcut();
-    QMap<QStringList, int>::iterator i;
-    for (i = keylist.begin(); i != keylist.end(); ++i) {
-        if (bit == i.value() && i.key().last() == list.last()) {
-            return false;
-        }
-    }
+    if (list.isEmpty())
+        return true;
 
-    return true;
+    return !m_model->isShortcutOccupied(bit, list.last());
 }
 
 #ifndef DCC_DISABLE_KBLAYOUT
 void KeyboardWorker::onRefreshKBLayout()
 {
-    QDBusPendingCallWatcher *layoutResult = new QDBusPendingCallWatcher(m_keyboardInter->LayoutList(), this);
-    connect(layoutResult, &QDBusPendingCallWatcher::finished, this, &KeyboardWorker::onLayoutListsFinished);
-
-    onCurrentLayout(m_keyboardInter->currentLayout());
-    onUserLayout(m_keyboardInter->userLayoutList());
+    // 对照表已就绪时直接从内存填充，不再请求后端
+    m_layoutCatalogue->load();
 }
 #endif
 
@@ -346,7 +346,7 @@ void KeyboardWorker::onRequestShortcut(QDBusPendingCallWatcher *watch)
     QString info = reply.value();
 
     QMap<QStringList,int> map;
-    QJsonArray array = QJsonDocument::fromJson(info.toStdString().c_str()).array();
+    QJsonArray array = QJsonDocument::fromJson(info.toUtf8()).array();
     Q_FOREACH(QJsonValue value, array) {
         QJsonObject obj = value.toObject();
         if (obj.isEmpty())
@@ -412,14 +412,12 @@ void KeyboardWorker::onAddedFinished(QDBusPendingCallWatcher *watch)
 }
 
 #ifndef DCC_DISABLE_KBLAYOUT
-void KeyboardWorker::onLayoutListsFinished(QDBusPendingCallWatcher *watch)
+void KeyboardWorker::onLayoutCatalogueLoaded()
 {
-    QDBusPendingReply<KeyboardLayoutList> reply = *watch;
-
-    KeyboardLayoutList tmp_map = reply.value();
-    m_model->setLayoutLists(tmp_map);
+    m_model->setLayoutLists(m_layoutCatalogue->layouts());
 
-    watch->deleteLater();
+    onCurrentLayout(m_keyboardInter->currentLayout());
+    onUserLayout(m_keyboardInter->userLayoutList());
 }
 #endif
 
@@ -456,7 +454,18 @@ void KeyboardWorker::onUserLayout(const QStringList &list)
     m_model->cleanUserLayout();
     m_model->getUserLayoutList() = list;
 
+    // 对照表加载结束后由 onLayoutCatalogueLoaded 统一填充
+    if (m_layoutCatalogue->isLoading())
+        return;
+
     for (const QString &data : list) {
+        const QString &desc = m_layoutCatalogue->description(data);
+        if (!desc.isEmpty()) {
+            m_model->addUserLayout(data, desc);
+            continue;
+        }
+
+        // 对照表中没有的布局单独查询
         QDBusPendingCallWatcher *layoutResult = new QDBusPendingCallWatcher(m_keyboardInter->GetLayoutDesc(data), this);
         layoutResult->setProperty("id", data);
         connect(layoutResult, &QDBusPendingCallWatcher::finished, this, &KeyboardWorker::onUserLayoutFinished);
@@ -474,6 +483,12 @@ void KeyboardWorker::onUserLayoutFinished(QDBusPendingCallWatcher *watch)
 
 void KeyboardWorker::onCurrentLayout(const QString &value)
 {
+    const QString &desc = m_layoutCatalogue->description(value);
+    if (!desc.isEmpty()) {
+        m_model->setLayout(desc);
+        return;
+    }
+
     QDBusPendingCallWatcher *layoutResult = new QDBusPendingCallWatcher(m_keyboardInter->GetLayoutDesc(value), this);
     connect(layoutResult, &QDBusPendingCallWatcher::finished, this, &KeyboardWorker::onCurrentLayoutFinished);
 }
@@ -481,9 +496,8 @@ void KeyboardWorker::onCurrentLayout(const QString &value)
 void KeyboardWorker::onSearchShortcuts(const QString &searchKey)
 {
     qDebug() << "onSearchShortcuts: " << searchKey;
-    QDBusPendingReply<QString> reply = m_keybindInter->SearchShortcuts(searchKey);
-    QDBusPendingCallWatcher *searchResult = new QDBusPendingCallWatcher(reply, this);
-    connect(searchResult, &QDBusPendingCallWatcher::finished, this, &KeyboardWorker::onSearchFinished);
+    if (m_shortcutModel)
+        m_shortcutModel->search(searchKey);
 }
 
 void KeyboardWorker::onCurrentLayoutFinished(QDBusPendingCallWatcher *watch)
@@ -495,46 +509,29 @@ void KeyboardWorker::onCurrentLayoutFinished(QDBusPendingCallWatcher *watch)
     watch->deleteLater();
 }
 
-void KeyboardWorker::onSearchFinished(QDBusPendingCallWatcher *watch)
-{
-    QDBusPendingReply<QString> reply = *watch;
-    if (m_shortcutModel && !watch->isError()) {
-        m_shortcutModel->setSearchResult(reply.value());
-    } else {
-        qDebug() << "search finished error." << watch->error();
-    }
-    watch->deleteLater();
-}
-
 void KeyboardWorker::onPinyin()
 {
     m_letters.clear();
     m_metaDatas.clear();
-    QDBusInterface dbus_pinyin("com.deepin.api.Pinyin", "/com/deepin/api/Pinyin",
-                               "com.deepin.api.Pinyin");
 
-    Q_FOREACH(const QString &str, m_model->kbLayout().keys()) {
+    QLocale locale;
+    LayoutSortKeys &sortKeys = LayoutSortKeys::instance();
+    const QMap<QString, QString> &layouts = m_model->kbLayout();
+    m_metaDatas.reserve(layouts.size());
+    for (auto it(layouts.cbegin()); it != layouts.cend(); ++it) {
         MetaData md;
-        QString title = m_model->kbLayout()[str];
-        md.setText(title);
-        md.setKey(str);
-        QChar letterFirst = title[0];
-        QStringList letterFirstList;
-        if (letterFirst.isLower() || letterFirst.isUpper()) {
-            letterFirstList << QString(letterFirst);
-            md.setPinyin(title);
-        } else {
-            QDBusMessage message = dbus_pinyin.call("Query", title);
-            letterFirstList = message.arguments()[0].toStringList();
-            md.setPinyin(letterFirstList.at(0));
-        }
-
-        append(md);
+        md.setText(it.value());
+        md.setKey(it.key());
+        md.setPinyin(sortKeys.sortKey(locale.name(), it.value()));
+        m_metaDatas.append(md);
     }
 
-    QLocale locale;
-
     if (locale.language() == QLocale::Chinese) {
+        // 拼音相同的布局保持原有顺序
+        std::stable_sort(m_metaDatas.begin(), m_metaDatas.end(), [](const MetaData &md1, const MetaData &md2) {
+            return md2 > md1;
+        });
+
         QChar ch = '\0';
         for (int i(0); i != m_metaDatas.size(); ++i)
         {
@@ -547,33 +544,15 @@ void KeyboardWorker::onPinyin()
             m_metaDatas.insert(i, MetaData(ch, true));
         }
     } else {
-        qSort(m_metaDatas.begin(), m_metaDatas.end(), caseInsensitiveLessThan);
+        QCollator collator;
+        std::sort(m_metaDatas.begin(), m_metaDatas.end(), [&collator](const MetaData &md1, const MetaData &md2) {
+            return collator.compare(md1.text(), md2.text()) < 0;
+        });
     }
 
     Q_EMIT onDatasChanged(m_metaDatas);
     Q_EMIT onLettersChanged(m_letters);
 }
-
-void KeyboardWorker::append(const MetaData &md)
-{
-    if(m_metaDatas.count() == 0)
-    {
-        m_metaDatas.append(md);
-        return;
-    }
-
-    int index = 0;
-    for (int i = 0; i != m_metaDatas.size(); ++i) {
-        if(m_metaDatas.at(i) > md)
-        {
-            m_metaDatas.insert(index,md);
-            return;
-        }
-        index++;
-    }
-
-    m_metaDatas.append(md);
-}
 #endif
 
 #ifndef DCC_DISABLE_LANGUAGE
@@ -591,6 +570,15 @@ void KeyboardWorker::onShortcutChanged(const QString &id, int type)
     connect(result, &QDBusPendingCallWatcher::finished, this, &KeyboardWorker::onGetShortcutFinished);
 }
 
+void KeyboardWorker::onShortcutDeleted(const QString &id, int type)
+{
+    // 先移除界面上的条目，再从模型中释放
+    Q_EMIT removed(id, type);
+
+    if (m_shortcutModel)
+        m_shortcutModel->onKeyBindingDeleted(id, type);
+}
+
 void KeyboardWorker::onGetShortcutFinished(QDBusPendingCallWatcher *watch)
 {
     QDBusPendingReply<QString> reply = *watch;
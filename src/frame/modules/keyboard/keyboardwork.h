@@ -22,6 +22,8 @@ using KeyboardInter = com::deepin::daemon::inputdevice::Keyboard;
 using LangSelector = com::deepin::daemon::LangSelector;
 using KeybingdingInter = com::deepin::daemon::Keybinding;
 
+class LayoutCatalogue;
+
 class KeyboardWorker : public QObject
 {
     Q_OBJECT
@@ -101,15 +103,13 @@ public Q_SLOTS:
     void onLocalListsFinished(QDBusPendingCallWatcher *watch);
     void onGetWindowWM(bool value);
 #ifndef DCC_DISABLE_KBLAYOUT
-    void onLayoutListsFinished(QDBusPendingCallWatcher *watch);
+    void onLayoutCatalogueLoaded();
     void onUserLayout(const QStringList &list);
     void onUserLayoutFinished(QDBusPendingCallWatcher *watch);
     void onCurrentLayout(const QString &value);
     void onCurrentLayoutFinished(QDBusPendingCallWatcher *watch);
     void onPinyin();
     void onSearchShortcuts(const QString &searchKey);
-    void onSearchFinished(QDBusPendingCallWatcher *watch);
-    void append(const MetaData& md);
 #endif
 
 #ifndef DCC_DISABLE_LANGUAGE
@@ -117,6 +117,7 @@ public Q_SLOTS:
 #endif
 
     void onShortcutChanged(const QString &id, int type);
+    void onShortcutDeleted(const QString &id, int type);
     void onGetShortcutFinished(QDBusPendingCallWatcher *watch);
     void updateKey(ShortcutInfo *info);
 
@@ -146,6 +147,9 @@ private:
     KeybingdingInter* m_keybindInter;
     ShortcutModel *m_shortcutModel = nullptr;
     WM *m_wm;
+#ifndef DCC_DISABLE_KBLAYOUT
+    LayoutCatalogue *m_layoutCatalogue;
+#endif
 };
 }
 }
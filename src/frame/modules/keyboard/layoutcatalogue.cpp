@@ -0,0 +1,141 @@
+// SPDX-FileCopyrightText: 2022 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include "layoutcatalogue.h"
+
+#include <QDataStream>
+#include <QDateTime>
+#include <QDebug>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QLocale>
+#include <QSaveFile>
+#include <QStandardPaths>
+
+// 后端读取的 xkb 布局规则，布局列表和描述都来自这里
+const QString XkbRulesFile = "/usr/share/X11/xkb/rules/base.xml";
+
+const quint32 CatalogueMagic = 0x44434b4c; // "DCKL"
+const quint32 CatalogueVersion = 1;
+
+using namespace dcc::keyboard;
+
+LayoutCatalogue::LayoutCatalogue(com::deepin::daemon::inputdevice::Keyboard *keyboardInter, QObject *parent)
+    : QObject(parent)
+    , m_keyboardInter(keyboardInter)
+    , m_ready(false)
+    , m_loading(false)
+{
+}
+
+void LayoutCatalogue::load()
+{
+    // 布局描述由后端按当前语言翻译，语言变化后重新加载
+    const QString &locale = QLocale::system().name();
+    if (locale != m_locale) {
+        m_locale = locale;
+        m_ready = false;
+        m_layouts.clear();
+    }
+
+    if (m_loading)
+        return;
+
+    if (!m_ready && readCache(m_layouts))
+        m_ready = true;
+
+    if (m_ready) {
+        Q_EMIT loadFinished();
+        return;
+    }
+
+    m_loading = true;
+    QDBusPendingCallWatcher *watcher = new QDBusPendingCallWatcher(m_keyboardInter->LayoutList(), this);
+    connect(watcher, &QDBusPendingCallWatcher::finished, this, &LayoutCatalogue::onLayoutListFinished);
+}
+
+void LayoutCatalogue::onLayoutListFinished(QDBusPendingCallWatcher *watch)
+{
+    QDBusPendingReply<KeyboardLayoutList> reply = *watch;
+    watch->deleteLater();
+    m_loading = false;
+
+    if (reply.isError()) {
+        qWarning() << "get keyboard layout list failed:" << reply.error();
+    } else {
+        m_layouts = reply.value();
+        m_ready = true;
+        writeCache(m_layouts);
+    }
+
+    Q_EMIT loadFinished();
+}
+
+QString LayoutCatalogue::cachePath() const
+{
+    return QString("%1/deepin/dde-control-center/keyboard/layouts-%2.cache")
+            .arg(QStandardPaths::writableLocation(QStandardPaths::GenericCacheLocation))
+            .arg(m_locale);
+}
+
+bool LayoutCatalogue::readCache(KeyboardLayoutList &layouts) const
+{
+    QFileInfo info(XkbRulesFile);
+    if (!info.exists())
+        return false;
+
+    QFile file(cachePath());
+    if (!file.open(QIODevice::ReadOnly))
+        return false;
+
+    QDataStream in(&file);
+    in.setVersion(QDataStream::Qt_5_0);
+
+    quint32 magic = 0;
+    quint32 version = 0;
+    in >> magic >> version;
+    if (magic != CatalogueMagic || version != CatalogueVersion)
+        return false;
+
+    QString locale;
+    qint64 mtime = 0;
+    qint64 size = 0;
+    in >> locale >> mtime >> size;
+    if (locale != m_locale || mtime != info.lastModified().toMSecsSinceEpoch() || size != info.size())
+        return false;
+
+    in >> layouts;
+    if (in.status() != QDataStream::Ok || layouts.isEmpty()) {
+        qWarning() << "broken keyboard layout cache:" << file.fileName();
+        layouts.clear();
+        return false;
+    }
+
+    return true;
+}
+
+void LayoutCatalogue::writeCache(const KeyboardLayoutList &layouts) const
+{
+    QFileInfo info(XkbRulesFile);
+    if (!info.exists() || layouts.isEmpty())
+        return;
+
+    const QString &path = cachePath();
+    QDir().mkpath(QFileInfo(path).absolutePath());
+
+    // 多个实例可能同时写入，写入临时文件后再替换
+    QSaveFile file(path);
+    if (!file.open(QIODevice::WriteOnly)) {
+        qWarning() << "failed to write keyboard layout cache:" << path;
+        return;
+    }
+
+    QDataStream out(&file);
+    out.setVersion(QDataStream::Qt_5_0);
+    out << CatalogueMagic << CatalogueVersion << m_locale << info.lastModified().toMSecsSinceEpoch() << info.size();
+    out << layouts;
+
+    file.commit();
+}
@@ -0,0 +1,57 @@
+// SPDX-FileCopyrightText: 2022 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#ifndef LAYOUTCATALOGUE_H
+#define LAYOUTCATALOGUE_H
+
+#include <QObject>
+
+#include <com_deepin_daemon_inputdevice_keyboard.h>
+
+class QDBusPendingCallWatcher;
+
+namespace dcc {
+namespace keyboard {
+
+// 键盘布局 -> 布局描述的完整对照表
+// 整表通过一次 LayoutList 调用取得，之后的单个布局查询直接从内存返回，不再逐个调用 GetLayoutDesc；
+// 对照表同时缓存在 ~/.cache/deepin/dde-control-center/keyboard 下，以 xkb 规则文件的修改时间、大小和语言校验
+class LayoutCatalogue : public QObject
+{
+    Q_OBJECT
+public:
+    explicit LayoutCatalogue(com::deepin::daemon::inputdevice::Keyboard *keyboardInter, QObject *parent = nullptr);
+
+    // 对照表未就绪时加载，加载结束后发出 loadFinished；已就绪时立即发出
+    void load();
+
+    bool isReady() const { return m_ready; }
+    bool isLoading() const { return m_loading; }
+    const KeyboardLayoutList &layouts() const { return m_layouts; }
+    // 返回布局描述，对照表中没有该布局时返回空字符串
+    QString description(const QString &layout) const { return m_layouts.value(layout); }
+
+Q_SIGNALS:
+    // 加载失败时 isReady() 为 false，下次 load() 重新请求
+    void loadFinished();
+
+private:
+    void onLayoutListFinished(QDBusPendingCallWatcher *watch);
+
+    QString cachePath() const;
+    bool readCache(KeyboardLayoutList &layouts) const;
+    void writeCache(const KeyboardLayoutList &layouts) const;
+
+private:
+    com::deepin::daemon::inputdevice::Keyboard *m_keyboardInter;
+    KeyboardLayoutList m_layouts;
+    QString m_locale;
+    bool m_ready;
+    bool m_loading;
+};
+
+}
+}
+
+#endif // LAYOUTCATALOGUE_H
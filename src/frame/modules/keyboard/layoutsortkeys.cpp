@@ -0,0 +1,31 @@
+// SPDX-FileCopyrightText: 2022 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include "layoutsortkeys.h"
+
+#include "modules/pinyinconverter.h"
+
+using namespace dcc::keyboard;
+
+LayoutSortKeys &LayoutSortKeys::instance()
+{
+    static LayoutSortKeys keys;
+    return keys;
+}
+
+QString LayoutSortKeys::sortKey(const QString &locale, const QString &title)
+{
+    if (title.isEmpty())
+        return title;
+
+    QHash<QString, QString> &keys = m_keys[locale];
+    auto it = keys.constFind(title);
+    if (it != keys.cend())
+        return it.value();
+
+    const QChar letterFirst = title.at(0);
+    const QString &key = (letterFirst.isLower() || letterFirst.isUpper()) ? title : dcc::PinyinConverter::full(title);
+    keys.insert(title, key);
+    return key;
+}
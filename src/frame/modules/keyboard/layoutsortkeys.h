@@ -0,0 +1,36 @@
+// SPDX-FileCopyrightText: 2022 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#ifndef LAYOUTSORTKEYS_H
+#define LAYOUTSORTKEYS_H
+
+#include <QHash>
+#include <QString>
+
+namespace dcc {
+namespace keyboard {
+
+// 键盘布局名称的排序键
+// 非拉丁名称在进程内转换为拼音，与搜索使用同一份 DTK 拼音数据，不再逐条调用 com.deepin.api.Pinyin；
+// 结果按语言缓存，再次打开添加布局页面时直接复用。只能在主线程中使用
+class LayoutSortKeys
+{
+public:
+    static LayoutSortKeys &instance();
+
+    // 返回 locale 下布局名称 title 的排序键，拉丁字母开头的名称原样返回
+    QString sortKey(const QString &locale, const QString &title);
+
+private:
+    LayoutSortKeys() = default;
+    Q_DISABLE_COPY(LayoutSortKeys)
+
+private:
+    QHash<QString, QHash<QString, QString>> m_keys; // 语言 -> 布局名称 -> 排序键
+};
+
+}
+}
+
+#endif // LAYOUTSORTKEYS_H
@@ -0,0 +1,112 @@
+// SPDX-FileCopyrightText: 2022 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include "shortcutconflictindex.h"
+#include "shortcutmodel.h"
+
+using namespace dcc::keyboard;
+
+QString ShortcutConflictIndex::normalize(const QString &accels)
+{
+    static const QString modifiers[] = { "Shift", "Control", "Alt", "Super" };
+    bool pressed[4] = { false, false, false, false };
+    QString others;
+    QString key;
+
+    int pos = 0;
+    while (pos < accels.size()) {
+        if (accels.at(pos) != '<') {
+            // 尖括号外的部分是主键
+            const int next = accels.indexOf('<', pos);
+            key = accels.mid(pos, next < 0 ? -1 : next - pos);
+            if (next < 0)
+                break;
+            pos = next;
+            continue;
+        }
+
+        const int end = accels.indexOf('>', pos);
+        if (end < 0) {
+            key = accels.mid(pos);
+            break;
+        }
+
+        const QStringRef &token = accels.midRef(pos, end - pos + 1);
+        bool isModifier = false;
+        for (int i = 0; i < 4 && !isModifier; ++i) {
+            if (token.contains(modifiers[i])) {
+                pressed[i] = true;
+                isModifier = true;
+            }
+        }
+        if (!isModifier)
+            others.append(token);
+
+        pos = end + 1;
+    }
+
+    QString result;
+    for (int i = 0; i < 4; ++i) {
+        if (pressed[i])
+            result.append('<' + modifiers[i] + '>');
+    }
+    result.append(others);
+    result.append(key);
+    return result.toCaseFolded();
+}
+
+void ShortcutConflictIndex::clear()
+{
+    m_infos.clear();
+    m_keys.clear();
+}
+
+void ShortcutConflictIndex::update(ShortcutInfo *info)
+{
+    const QString &key = normalize(info->accels);
+    auto it = m_keys.find(info);
+    if (it != m_keys.end()) {
+        if (it.value() == key)
+            return;
+
+        remove(info);
+    }
+
+    m_keys.insert(info, key);
+    // 没有设置按键的快捷键不会与任何按键冲突
+    if (!key.isEmpty())
+        m_infos[key].append(info);
+}
+
+void ShortcutConflictIndex::remove(ShortcutInfo *info)
+{
+    auto it = m_keys.find(info);
+    if (it == m_keys.end())
+        return;
+
+    auto infos = m_infos.find(it.value());
+    if (infos != m_infos.end()) {
+        infos->removeOne(info);
+        if (infos->isEmpty())
+            m_infos.erase(infos);
+    }
+
+    m_keys.erase(it);
+}
+
+QList<ShortcutInfo *> ShortcutConflictIndex::conflicts(const QString &accels) const
+{
+    const QString &key = normalize(accels);
+    QList<ShortcutInfo *> result;
+    if (key.isEmpty())
+        return result;
+
+    // 按键应通过 ShortcutModel::setAccels 修改并重新索引；仍按当前的按键校验一次，避免过期的条目被误报
+    for (ShortcutInfo *info : m_infos.value(key)) {
+        if (normalize(info->accels) == key)
+            result << info;
+    }
+
+    return result;
+}
@@ -0,0 +1,42 @@
+// SPDX-FileCopyrightText: 2022 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#ifndef SHORTCUTCONFLICTINDEX_H
+#define SHORTCUTCONFLICTINDEX_H
+
+#include <QHash>
+#include <QList>
+#include <QString>
+
+namespace dcc {
+namespace keyboard {
+
+struct ShortcutInfo;
+
+// 快捷键按键冲突索引
+// 按规范化后的按键组合索引快捷键：修饰键按 Shift、Control、Alt、Super 排序，忽略大小写，
+// 与 Wayland 下 parseKeystroke 的顺序一致，录制按键时查找冲突的耗时与快捷键数量无关
+class ShortcutConflictIndex
+{
+public:
+    // 如 <Alt><Super><Control><Shift>L 与 <Shift><Control><Alt><Super>l 规范化结果相同
+    static QString normalize(const QString &accels);
+
+    void clear();
+    // 按 info 当前的按键加入索引，已在索引中时按新的按键重新索引
+    void update(ShortcutInfo *info);
+    void remove(ShortcutInfo *info);
+
+    // 返回按键与 accels 相同的全部快捷键，按加入索引的顺序排列
+    QList<ShortcutInfo *> conflicts(const QString &accels) const;
+
+private:
+    QHash<QString, QList<ShortcutInfo *>> m_infos; // 规范化按键 -> 快捷键
+    QHash<ShortcutInfo *, QString> m_keys;         // 快捷键 -> 加入索引时的规范化按键
+};
+
+}
+}
+
+#endif // SHORTCUTCONFLICTINDEX_H
@@ -162,7 +162,7 @@ void ShortcutContent::onReplace()
         if (m_shortcut.isEmpty()) {
             Q_EMIT requestDisableShortcut(m_info);
         } else {
-            m_info->accels = m_shortcut;
+            m_model->setAccels(m_info, m_shortcut);
             Q_EMIT requestSaveShortcut(m_info);
         }
     }
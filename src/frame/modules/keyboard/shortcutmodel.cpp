@@ -13,6 +13,8 @@
 #include <QThreadPool>
 #include <QGuiApplication>
 
+#include <algorithm>
+
 #include "shortcutitem.h"
 
 static const QStringList systemFilter = {"terminal",
@@ -52,11 +54,47 @@ static QStringList workspaceFilter = {"switch-to-workspace-left",
 
 static QStringList assistiveToolsFilter = {"ai-assistant", "text-to-speech", "speech-to-text", "translation"};
 
+// id -> 在过滤列表中的顺序
+static QHash<QString, int> rankTable(const QStringList &filter)
+{
+    QHash<QString, int> ranks;
+    ranks.reserve(filter.size());
+    for (int i = 0; i < filter.size(); ++i)
+        ranks.insert(filter.at(i), i);
+    return ranks;
+}
+
 namespace dcc {
 namespace keyboard {
 
+static void readInfo(const QJsonObject &obj, ShortcutInfo *info)
+{
+    info->type    = obj["Type"].toInt();
+    info->accels  = obj["Accels"].toArray().first().toString();
+    info->name    = obj["Name"].toString();
+    info->id      = obj["Id"].toString();
+    info->command = obj["Exec"].toString();
+}
+
+// 用 obj 更新 info，返回内容是否有变化
+static bool updateInfo(const QJsonObject &obj, ShortcutInfo *info)
+{
+    ShortcutInfo updated;
+    readInfo(obj, &updated);
+    if (updated.accels == info->accels && updated.name == info->name && updated.command == info->command)
+        return false;
+
+    info->accels  = updated.accels;
+    info->name    = updated.name;
+    info->command = updated.command;
+    return true;
+}
+
 ShortcutModel::ShortcutModel(QObject *parent)
     : QObject(parent)
+    , m_windowRanks(rankTable(windowFilter))
+    , m_workspaceRanks(rankTable(workspaceFilter))
+    , m_assistiveToolsRanks(rankTable(assistiveToolsFilter))
     , m_windowSwitchState(false)
 {
     if (m_dis.monitorList().size() > 1) {
@@ -94,6 +132,9 @@ ShortcutModel::~ShortcutModel()
 {
     qDeleteAll(m_infos);
 
+    m_index.clear();
+    m_conflicts.clear();
+    m_searchEngine.clear();
     m_infos.clear();
     m_systemInfos.clear();
     m_windowInfos.clear();
@@ -133,20 +174,20 @@ QList<ShortcutInfo *> ShortcutModel::infos() const
     return m_infos;
 }
 
+ShortcutInfo *ShortcutModel::find(const QString &id, int type) const
+{
+    return m_index.value(ShortcutKey(type, id));
+}
+
 void ShortcutModel::delInfo(ShortcutInfo *info)
 {
-    if (m_infos.contains(info)) {
-        m_infos.removeOne(info);
-    }
-    if (m_customInfos.contains(info)) {
-        m_customInfos.removeOne(info);
-    }
+    removeInfo(info);
 
     delete info;
     info = nullptr;
 }
 
-void ShortcutModel::onParseInfo(const QString &info)
+QHash<QString, int> ShortcutModel::systemRanks() const
 {
     QStringList systemShortKeys;
     if (DCC_NAMESPACE::IsServerSystem) {
@@ -174,88 +215,180 @@ void ShortcutModel::onParseInfo(const QString &info)
     systemFilterServer.removeOne("deepin-screen-recorder");
     systemShortKeys = systemFilterServer;
 #endif
-    qDeleteAll(m_infos);
 
-    m_infos.clear();
-    m_systemInfos.clear();
-    m_windowInfos.clear();
-    m_workspaceInfos.clear();
-    m_assistiveToolsInfos.clear();
-    m_customInfos.clear();
+    return rankTable(systemShortKeys);
+}
 
-    QJsonArray array = QJsonDocument::fromJson(info.toStdString().c_str()).array();
+int ShortcutModel::category(const ShortcutInfo *info, const QHash<QString, int> &systemRanks, int *rank) const
+{
+    if (info->type == MEDIAKEY)
+        return -1;
+
+    const QPair<InfoType, const QHash<QString, int> *> tables[] = {
+        { System, &systemRanks },
+        { Window, &m_windowRanks },
+        { Workspace, &m_workspaceRanks },
+        { AssistiveTools, &m_assistiveToolsRanks }
+    };
+    for (const auto &table : tables) {
+        auto it = table.second->constFind(info->id);
+        if (it != table.second->cend()) {
+            if (rank)
+                *rank = it.value();
+            return table.first;
+        }
+    }
 
-    Q_FOREACH (QJsonValue value, array) {
-        QJsonObject obj  = value.toObject();
-        int         type = obj["Type"].toInt();
+    if (info->type == Custom) {
+        if (rank)
+            *rank = 0;
+        return Custom;
+    }
 
-        ShortcutInfo *info = new ShortcutInfo();
-        info->type         = type;
-        info->accels       = obj["Accels"].toArray().first().toString();
-        info->name    = obj["Name"].toString();
-        info->id      = obj["Id"].toString();
-        info->command = obj["Exec"].toString();
+    return -1;
+}
+
+QList<ShortcutInfo *> *ShortcutModel::categoryList(int type)
+{
+    switch (type) {
+    case System:
+        return &m_systemInfos;
+    case Window:
+        return &m_windowInfos;
+    case Workspace:
+        return &m_workspaceInfos;
+    case AssistiveTools:
+        return &m_assistiveToolsInfos;
+    case Custom:
+        return &m_customInfos;
+    default:
+        return nullptr;
+    }
+}
 
-        m_infos << info;
+void ShortcutModel::removeInfo(ShortcutInfo *info)
+{
+    const ShortcutKey key(info->type, info->id);
+    if (m_index.value(key) == info)
+        m_index.remove(key);
+    m_conflicts.remove(info);
+    m_searchEngine.remove(info);
+
+    m_infos.removeOne(info);
+    m_systemInfos.removeOne(info);
+    m_windowInfos.removeOne(info);
+    m_workspaceInfos.removeOne(info);
+    m_assistiveToolsInfos.removeOne(info);
+    m_customInfos.removeOne(info);
+
+    if (m_currentInfo == info)
+        m_currentInfo = nullptr;
+}
 
-        if (type != MEDIAKEY) {
-            if (systemShortKeys.contains(info->id)) {
-                m_systemInfos << info;
-                continue;
-            }
-            if (windowFilter.contains(info->id)) {
-                m_windowInfos << info;
-                continue;
-            }
-            if (workspaceFilter.contains(info->id)) {
-                m_workspaceInfos << info;
-                continue;
-            }
-            if (assistiveToolsFilter.contains(info->id)) {
-                m_assistiveToolsInfos << info;
-                continue;
-            }
-            if (type == 1) {
-                m_customInfos << info;
-            }
+void ShortcutModel::onParseInfo(const QString &info)
+{
+    const QHash<QString, int> &ranks = systemRanks();
+    const QJsonArray array = QJsonDocument::fromJson(info.toUtf8()).array();
+
+    // 已有的快捷键原地更新，界面持有的指针保持有效
+    QHash<ShortcutKey, ShortcutInfo *> index;
+    index.reserve(array.size());
+    QList<ShortcutInfo *> infos;
+    infos.reserve(array.size());
+    QList<ShortcutInfo *> changed;
+    QMap<int, QList<QPair<int, ShortcutInfo *>>> categories; // 分类 -> (顺序, 快捷键)
+
+    for (const QJsonValue &value : array) {
+        const QJsonObject &obj = value.toObject();
+        const ShortcutKey key(obj["Type"].toInt(), obj["Id"].toString());
+        if (index.contains(key))
+            continue;
+
+        ShortcutInfo *shortcut = m_index.take(key);
+        if (!shortcut) {
+            shortcut = new ShortcutInfo();
+            readInfo(obj, shortcut);
+        } else if (updateInfo(obj, shortcut)) {
+            changed << shortcut;
         }
+
+        index.insert(key, shortcut);
+        infos << shortcut;
+        m_conflicts.update(shortcut);
+        m_searchEngine.update(shortcut);
+
+        int rank = 0;
+        const int type = category(shortcut, ranks, &rank);
+        if (type != -1)
+            categories[type] << qMakePair(rank, shortcut);
     }
 
-    qSort(m_systemInfos.begin(), m_systemInfos.end(), [ = ](ShortcutInfo *s1, ShortcutInfo *s2) {
-        return systemShortKeys.indexOf(s1->id) < systemShortKeys.indexOf(s2->id);
-    });
+    // 剩下的是已被删除的快捷键，界面更新后再释放
+    const QList<ShortcutInfo *> removed = m_index.values();
+    m_index = index;
+    m_infos = infos;
+    if (removed.contains(m_currentInfo))
+        m_currentInfo = nullptr;
+    for (ShortcutInfo *shortcut : removed) {
+        m_conflicts.remove(shortcut);
+        m_searchEngine.remove(shortcut);
+    }
 
-    qSort(m_windowInfos.begin(), m_windowInfos.end(), [ = ](ShortcutInfo *s1, ShortcutInfo *s2) {
-        return windowFilter.indexOf(s1->id) < windowFilter.indexOf(s2->id);
-    });
+    QList<InfoType> changedTypes;
+    for (InfoType type : { System, Window, Workspace, AssistiveTools, Custom }) {
+        QList<QPair<int, ShortcutInfo *>> &entries = categories[type];
+        // 自定义快捷键保持后端返回的顺序
+        if (type != Custom) {
+            std::stable_sort(entries.begin(), entries.end(), [](const QPair<int, ShortcutInfo *> &e1, const QPair<int, ShortcutInfo *> &e2) {
+                return e1.first < e2.first;
+            });
+        }
 
-    qSort(m_workspaceInfos.begin(), m_workspaceInfos.end(), [ = ](ShortcutInfo *s1, ShortcutInfo *s2) {
-        return workspaceFilter.indexOf(s1->id) < workspaceFilter.indexOf(s2->id);
-    });
+        QList<ShortcutInfo *> list;
+        list.reserve(entries.size());
+        for (const auto &entry : entries)
+            list << entry.second;
 
-    qSort(m_assistiveToolsInfos.begin(), m_assistiveToolsInfos.end(), [ = ](ShortcutInfo *s1, ShortcutInfo *s2) {
-        return assistiveToolsFilter.indexOf(s1->id) < assistiveToolsFilter.indexOf(s2->id);
-    });
+        QList<ShortcutInfo *> *current = categoryList(type);
+        if (*current != list) {
+            *current = list;
+            changedTypes << type;
+        }
+    }
+
+    for (InfoType type : changedTypes)
+        Q_EMIT listChanged(*categoryList(type), type);
 
-    Q_EMIT listChanged(m_systemInfos, InfoType::System);
-    Q_EMIT listChanged(m_windowInfos, InfoType::Window);
-    Q_EMIT listChanged(m_workspaceInfos, InfoType::Workspace);
-    Q_EMIT listChanged(m_assistiveToolsInfos, InfoType::AssistiveTools);
-    Q_EMIT listChanged(m_customInfos, InfoType::Custom);
+    // 分类列表没有变化时只更新内容变化的条目
+    for (ShortcutInfo *shortcut : changed) {
+        const int type = category(shortcut, ranks);
+        if (type == -1 || !changedTypes.contains(static_cast<InfoType>(type)))
+            Q_EMIT shortcutChanged(shortcut);
+    }
+
+    qDeleteAll(removed);
 }
 
 void ShortcutModel::onCustomInfo(const QString &json)
 {
-    QJsonObject   obj  = QJsonDocument::fromJson(json.toStdString().c_str()).object();
-    ShortcutInfo *info = new ShortcutInfo();
-    info->type         = obj["Type"].toInt();
-    QString accels     = obj["Accels"].toArray().at(0).toString();
-
-    info->accels = accels;
+    const QJsonObject &obj = QJsonDocument::fromJson(json.toUtf8()).object();
+    const ShortcutKey key(obj["Type"].toInt(), obj["Id"].toString());
+
+    // 刷新列表时已经加入的快捷键不再重复添加
+    if (ShortcutInfo *info = m_index.value(key)) {
+        if (updateInfo(obj, info)) {
+            m_conflicts.update(info);
+            m_searchEngine.update(info);
+            Q_EMIT shortcutChanged(info);
+        }
+        return;
+    }
 
-    info->name    = obj["Name"].toString();
-    info->id      = obj["Id"].toString();
-    info->command = obj["Exec"].toString();
+    ShortcutInfo *info = new ShortcutInfo();
+    readInfo(obj, info);
+    m_index.insert(key, info);
+    m_conflicts.update(info);
+    m_searchEngine.update(info);
     m_infos.append(info);
     m_customInfos.append(info);
     Q_EMIT addCustomInfo(info);
@@ -263,22 +396,25 @@ void ShortcutModel::onCustomInfo(const QString &json)
 
 void ShortcutModel::onKeyBindingChanged(const QString &value)
 {
-    const QJsonObject &obj       = QJsonDocument::fromJson(value.toStdString().c_str()).object();
-    const QString     &update_id = obj["Id"].toString();
-    auto res = std::find_if(m_infos.begin(), m_infos.end(), [ = ] (const ShortcutInfo *info)->bool{
-        return info->id == update_id;
-    });
-
-    if (res != m_infos.end()) {
-        (*res)->type = obj["Type"].toInt();
-        (*res)->accels  = obj["Accels"].toArray().first().toString();
-        (*res)->name    = obj["Name"].toString();
-        (*res)->command = obj["Exec"].toString();
-
-        Q_EMIT shortcutChanged((*res));
+    const QJsonObject &obj = QJsonDocument::fromJson(value.toUtf8()).object();
+    ShortcutInfo *info = m_index.value(ShortcutKey(obj["Type"].toInt(), obj["Id"].toString()));
+
+    if (info) {
+        updateInfo(obj, info);
+        m_conflicts.update(info);
+        m_searchEngine.update(info);
+
+        Q_EMIT shortcutChanged(info);
     }
 }
 
+void ShortcutModel::onKeyBindingDeleted(const QString &id, int type)
+{
+    ShortcutInfo *info = m_index.value(ShortcutKey(type, id));
+    if (info)
+        delInfo(info);
+}
+
 void ShortcutModel::onWindowSwitchChanged(bool value)
 {
     if (m_windowSwitchState != value) {
@@ -303,19 +439,26 @@ void ShortcutModel::setCurrentInfo(ShortcutInfo *currentInfo)
 
 ShortcutInfo *ShortcutModel::getInfo(const QString &shortcut)
 {
-    QString newShortcut = shortcut;
-    if (QGuiApplication::platformName().startsWith("wayland", Qt::CaseInsensitive)) {
-        newShortcut = parseKeystroke(newShortcut);
-    }
-    auto res = std::find_if(m_infos.begin(), m_infos.end(), [ = ] (const ShortcutInfo *info)->bool{
-        return !QString::compare(info->accels, newShortcut, Qt::CaseInsensitive); //判断是否相等，相等则返回0
-    });
+    const QList<ShortcutInfo *> &infos = conflicts(shortcut);
+    return infos.isEmpty() ? nullptr : infos.first();
+}
 
-    if (res != m_infos.end()) {
-        return *res;
-    }
+QList<ShortcutInfo *> ShortcutModel::conflicts(const QString &shortcut) const
+{
+    // 索引中的按键已按 parseKeystroke 的修饰键顺序规范化，wayland 下录制的按键无需再转换
+    return m_conflicts.conflicts(shortcut);
+}
+
+void ShortcutModel::setAccels(ShortcutInfo *info, const QString &accels)
+{
+    info->accels = accels;
+
+    // 搜索结果是副本，不在索引中
+    if (m_index.value(ShortcutKey(info->type, info->id)) != info)
+        return;
 
-    return nullptr;
+    m_conflicts.update(info);
+    m_searchEngine.update(info);
 }
 
 QString ShortcutModel::parseKeystroke(QString& shortcut)
@@ -346,82 +489,26 @@ QString ShortcutModel::parseKeystroke(QString& shortcut)
     return newShort;
 }
 
-void ShortcutModel::setSearchResult(const QString &searchResult)
+void ShortcutModel::search(const QString &key)
 {
     qDeleteAll(m_searchList);
     m_searchList.clear();
 
-    QList<ShortcutInfo *> systemInfoList;
-    QList<ShortcutInfo *> windowInfoList;
-    QList<ShortcutInfo *> workspaceInfoList;
-    QList<ShortcutInfo *> customInfoList;
-    QList<ShortcutInfo *> speechInfoList;
-
-    QJsonArray array = QJsonDocument::fromJson(searchResult.toStdString().c_str()).array();
-    for (auto value : array) {
-        QJsonObject obj  = value.toObject();
-        if ((obj["Id"].toString() == "wm-switcher") && (QGuiApplication::platformName().startsWith("wayland", Qt::CaseInsensitive))) {
-            continue;
-        }
-        int         type = obj["Type"].toInt();
-        ShortcutInfo *info = new ShortcutInfo();
-        info->type         = type;
-        info->accels       = obj["Accels"].toArray().first().toString();
-        info->name    = obj["Name"].toString();
-        info->id      = obj["Id"].toString();
-        info->command = obj["Exec"].toString();
-
-        if (type != MEDIAKEY) {
-            if (systemFilter.contains(info->id)) {
-                systemInfoList << info;
-                continue;
-            }
-            if (windowFilter.contains(info->id)) {
-                windowInfoList << info;
-                continue;
-            }
-            if (workspaceFilter.contains(info->id)) {
-                workspaceInfoList << info;
+    // 按分类列表的顺序输出，列表中不显示的快捷键也不出现在搜索结果中
+    const QSet<ShortcutInfo *> &matched = m_searchEngine.search(key);
+    for (InfoType type : { System, Window, Workspace, AssistiveTools, Custom }) {
+        for (ShortcutInfo *info : *categoryList(type)) {
+            if (!matched.contains(info))
                 continue;
-            }
-            if (assistiveToolsFilter.contains(info->id)) {
-                speechInfoList << info;
-                continue;
-            }
-
-            if (type == 1) {
-                customInfoList << info;
-            }else{
-                delete info;
-                info = nullptr;
-            }
 
-        } else {
-            qDebug() << "not search is:" << info->name;
-            delete info;
-            info = nullptr;
+            // 搜索结果使用副本，搜索项不会替换列表中快捷键对应的界面项
+            ShortcutInfo *result = new ShortcutInfo(*info);
+            result->replace = nullptr;
+            result->item = nullptr;
+            m_searchList << result;
         }
     }
 
-    qSort(systemInfoList.begin(), systemInfoList.end(), [ = ](ShortcutInfo *s1, ShortcutInfo *s2) {
-        return systemFilter.indexOf(s1->id) < systemFilter.indexOf(s2->id);
-    });
-    qSort(windowInfoList.begin(), windowInfoList.end(), [ = ](ShortcutInfo *s1, ShortcutInfo *s2) {
-        return windowFilter.indexOf(s1->id) < windowFilter.indexOf(s2->id);
-    });
-    qSort(workspaceInfoList.begin(), workspaceInfoList.end(), [ = ](ShortcutInfo *s1, ShortcutInfo *s2) {
-        return workspaceFilter.indexOf(s1->id) < workspaceFilter.indexOf(s2->id);
-    });
-    m_searchList.append(systemInfoList);
-    m_searchList.append(windowInfoList);
-    m_searchList.append(workspaceInfoList);
-    m_searchList.append(speechInfoList);
-    m_searchList.append(customInfoList);
-    int i = 0;
-    for (auto search : m_searchList) {
-        qDebug() << "search" << ++i << " is: " << search->name;
-    }
-
     Q_EMIT searchFinished(m_searchList);
 }
 }
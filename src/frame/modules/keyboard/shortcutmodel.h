@@ -9,7 +9,11 @@
 
 #include <QObject>
 #include <QMap>
+#include <QHash>
+#include <QPair>
 #include "modules/display/displaymodel.h"
+#include "shortcutconflictindex.h"
+#include "shortcutsearchengine.h"
 
 static const QMap<QString, QString> DisplaykeyMap = { {"exclam", "!"}, {"at", "@"}, {"numbersign", "#"}, {"dollar", "$"}, {"percent", "%"},
     {"asciicircum", "^"}, {"ampersand", "&"}, {"asterisk", "*"}, {"parenleft", "("},
@@ -70,13 +74,21 @@ public:
     QList<ShortcutInfo *> customInfo() const;
     QList<ShortcutInfo *> infos() const;
 
+    // 按 (type, id) 查找快捷键，不存在时返回 nullptr
+    ShortcutInfo *find(const QString &id, int type) const;
     void delInfo(ShortcutInfo *info);
 
     ShortcutInfo *currentInfo() const;
     void setCurrentInfo(ShortcutInfo *currentInfo);
 
+    // 返回第一个与 shortcut 按键相同的快捷键，没有冲突时返回 nullptr
     ShortcutInfo *getInfo(const QString &shortcut);
-    void setSearchResult(const QString &searchResult);
+    // 返回全部与 shortcut 按键相同的快捷键
+    QList<ShortcutInfo *> conflicts(const QString &shortcut) const;
+    // 修改快捷键的按键并重新索引，界面修改按键时必须通过此接口，不能等后端的 Changed 信号
+    void setAccels(ShortcutInfo *info, const QString &accels);
+    // 在已加载的快捷键中搜索 key，结果由 searchFinished 发出
+    void search(const QString &key);
     bool getWindowSwitch();
     QString parseKeystroke(QString& shortcuts);
 
@@ -92,10 +104,26 @@ public Q_SLOTS:
     void onParseInfo(const QString &info);
     void onCustomInfo(const QString &json);
     void onKeyBindingChanged(const QString &value);
+    void onKeyBindingDeleted(const QString &id, int type);
     void onWindowSwitchChanged(bool value);
 
 private:
-    QString m_info;
+    typedef QPair<int, QString> ShortcutKey;
+
+    QHash<QString, int> systemRanks() const;
+    // 返回快捷键所属的分类，不在任何分类中时返回 -1；rank 为在分类中的顺序
+    int category(const ShortcutInfo *info, const QHash<QString, int> &systemRanks, int *rank = nullptr) const;
+    QList<ShortcutInfo *> *categoryList(int type);
+    void removeInfo(ShortcutInfo *info);
+
+private:
+    // 全部快捷键，按 (type, id) 索引；分类列表和 m_infos 中的指针都来自这里
+    QHash<ShortcutKey, ShortcutInfo *> m_index;
+    ShortcutConflictIndex m_conflicts;
+    ShortcutSearchEngine m_searchEngine;
+    QHash<QString, int> m_windowRanks;
+    QHash<QString, int> m_workspaceRanks;
+    QHash<QString, int> m_assistiveToolsRanks;
     QList<ShortcutInfo *> m_infos;
     QList<ShortcutInfo *> m_systemInfos;
     QList<ShortcutInfo *> m_windowInfos;
@@ -0,0 +1,118 @@
+// SPDX-FileCopyrightText: 2022 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include "shortcutsearchengine.h"
+#include "shortcutmodel.h"
+
+#include "modules/pinyinconverter.h"
+
+#include <QRegExp>
+
+using namespace dcc::keyboard;
+
+void ShortcutSearchEngine::clear()
+{
+    m_entries.clear();
+    invalidate();
+}
+
+void ShortcutSearchEngine::update(ShortcutInfo *info)
+{
+    auto it = m_entries.find(info);
+    if (it != m_entries.end() && it->name == info->name && it->accels == info->accels)
+        return;
+
+    Entry entry;
+    entry.name = info->name;
+    entry.accels = info->accels;
+    entry.keys << info->name.toLower();
+
+    QString full;
+    QString initials;
+    dcc::PinyinConverter::convert(info->name, full, initials);
+    full = full.toLower();
+    if (full != entry.keys.first())
+        entry.keys << full;
+    if (!initials.isEmpty())
+        entry.keys << initials;
+
+    const QString &accels = accelsText(info->accels);
+    if (!accels.isEmpty())
+        entry.keys << accels;
+
+    m_entries.insert(info, entry);
+    invalidate();
+}
+
+void ShortcutSearchEngine::remove(ShortcutInfo *info)
+{
+    if (m_entries.remove(info))
+        invalidate();
+}
+
+QSet<ShortcutInfo *> ShortcutSearchEngine::search(const QString &text)
+{
+    const QStringList &words = text.toLower().split(QRegExp("\\s+"), QString::SkipEmptyParts);
+    QSet<ShortcutInfo *> result;
+    if (words.isEmpty()) {
+        invalidate();
+        return result;
+    }
+
+    // 追加输入只会缩小结果，在上次的结果中查找
+    const bool refine = m_lastValid && text.startsWith(m_lastText);
+    if (refine) {
+        for (ShortcutInfo *info : m_lastResult) {
+            if (matches(m_entries.value(info), words))
+                result << info;
+        }
+    } else {
+        for (auto it = m_entries.cbegin(); it != m_entries.cend(); ++it) {
+            if (matches(it.value(), words))
+                result << it.key();
+        }
+    }
+
+    m_lastValid = true;
+    m_lastText = text;
+    m_lastResult = result;
+    return result;
+}
+
+QString ShortcutSearchEngine::accelsText(const QString &accels)
+{
+    // 如 <Control><Alt>T 转换为界面上显示的 ctrl+alt+t
+    QStringList keys = QString(accels).replace(">", ">,").split(",", QString::SkipEmptyParts);
+    for (QString &key : keys) {
+        key.remove('<').remove('>');
+        key = DisplaykeyMap.value(key, key);
+    }
+
+    return keys.join('+').toLower();
+}
+
+bool ShortcutSearchEngine::matches(const Entry &entry, const QStringList &words)
+{
+    for (const QString &word : words) {
+        bool found = false;
+        for (const QString &key : entry.keys) {
+            if (key.contains(word)) {
+                found = true;
+                break;
+            }
+        }
+
+        if (!found)
+            return false;
+    }
+
+    return true;
+}
+
+void ShortcutSearchEngine::invalidate()
+{
+    m_lastValid = false;
+    m_lastText.clear();
+    m_lastResult.clear();
+}
@@ -0,0 +1,55 @@
+// SPDX-FileCopyrightText: 2022 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#ifndef SHORTCUTSEARCHENGINE_H
+#define SHORTCUTSEARCHENGINE_H
+
+#include <QHash>
+#include <QSet>
+#include <QString>
+#include <QStringList>
+
+namespace dcc {
+namespace keyboard {
+
+struct ShortcutInfo;
+
+// 快捷键搜索
+// 在进程内按名称、名称的全拼及拼音首字母、按键搜索已加载的快捷键，不再经 SearchShortcuts 由后端搜索；
+// 检索键随快捷键变化逐条更新，查询在上次查询的基础上追加输入时只校验上次的结果
+class ShortcutSearchEngine
+{
+public:
+    void clear();
+    // 按 info 当前的名称和按键更新检索键
+    void update(ShortcutInfo *info);
+    void remove(ShortcutInfo *info);
+
+    // 返回匹配 text 的快捷键：text 中以空白分隔的每个词都需包含在某个检索键中(忽略大小写)
+    QSet<ShortcutInfo *> search(const QString &text);
+
+private:
+    struct Entry {
+        QString name;
+        QString accels;
+        QStringList keys; // 小写检索键，依次为名称、全拼、拼音首字母、按键
+    };
+
+    static QString accelsText(const QString &accels);
+    static bool matches(const Entry &entry, const QStringList &words);
+    void invalidate();
+
+private:
+    QHash<ShortcutInfo *, Entry> m_entries;
+
+    // 上次查询，检索键变化后失效
+    bool m_lastValid = false;
+    QString m_lastText;
+    QSet<ShortcutInfo *> m_lastResult;
+};
+
+}
+}
+
+#endif // SHORTCUTSEARCHENGINE_H
@@ -16,7 +16,7 @@ NotificationWorker::NotificationWorker(NotificationModel *model, QObject *parent
     : QObject(parent)
     , m_model(model)
     , m_dbus(new Notification(Notification::staticInterfaceName(), Path, QDBusConnection::sessionBus(), this))
-    , m_theme(new Appearance(Appearance::staticInterfaceName(), "/com/deepin/daemon/Appearance", QDBusConnection::sessionBus(), this))
+    , m_theme(DBusProxyRegistry::get<Appearance>(Appearance::staticInterfaceName(), "/com/deepin/daemon/Appearance", QDBusConnection::sessionBus()))
 {
     connect(m_dbus, &Notification::AppAddedSignal, this, &NotificationWorker::onAppAdded);
     connect(m_dbus, &Notification::AppRemovedSignal, this, &NotificationWorker::onAppRemoved);
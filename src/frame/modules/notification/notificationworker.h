@@ -6,6 +6,7 @@
 
 #include "interface/namespace.h"
 #include "notificationmodel.h"
+#include "modules/dbusproxyregistry.h"
 #include <com_deepin_dde_notification.h>
 #include <com_deepin_daemon_appearance.h>
 
@@ -39,7 +40,7 @@ public Q_SLOTS:
 private:
     NotificationModel *m_model;
     Notification *m_dbus;
-    Appearance *m_theme;
+    SharedDBusProxy<Appearance> m_theme;
 };
 
 }// namespace msgnotify
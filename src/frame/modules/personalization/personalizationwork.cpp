@@ -41,7 +41,7 @@ const QList<int> FontSizeList {11, 12, 13, 14, 15, 16, 18, 20};
 PersonalizationWork::PersonalizationWork(PersonalizationModel *model, QObject *parent)
     : QObject(parent)
     , m_model(model)
-    , m_dbus(new Appearance(Service, Path, QDBusConnection::sessionBus(), this))
+    , m_dbus(DBusProxyRegistry::get<Appearance>(Service, Path, QDBusConnection::sessionBus()))
     , m_wmSwitcher(new WMSwitcher("com.deepin.WMSwitcher", "/com/deepin/WMSwitcher", QDBusConnection::sessionBus(), this))
     , m_wm(new WM("com.deepin.wm", "/com/deepin/wm", QDBusConnection::sessionBus(), this))
     , m_effects(new Effects("org.kde.KWin", "/Effects", QDBusConnection::sessionBus(), this))
@@ -107,7 +107,6 @@ PersonalizationWork::PersonalizationWork(PersonalizationModel *model, QObject *p
     m_fontModels["standardfont"]   = fontStand;
     m_fontModels["monospacefont"]  = fontMono;
 
-    m_dbus->setSync(false);
     m_wmSwitcher->setSync(false);
 }
 
@@ -194,7 +193,7 @@ void PersonalizationWork::refreshEffectModule()
 
 void PersonalizationWork::active()
 {
-    m_dbus->blockSignals(false);
+    // m_dbus 为共享代理，不能屏蔽其信号
     m_wmSwitcher->blockSignals(false);
 
     refreshWMState();
@@ -217,7 +216,6 @@ void PersonalizationWork::active()
 
 void PersonalizationWork::deactive()
 {
-    m_dbus->blockSignals(true);
     m_wmSwitcher->blockSignals(true);
 }
 
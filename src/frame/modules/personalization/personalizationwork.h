@@ -6,6 +6,7 @@
 #define PERSONALIZATIONWORK_H
 
 #include "personalizationmodel.h"
+#include "modules/dbusproxyregistry.h"
 #include <QObject>
 #include <QDebug>
 #include <QStringList>
@@ -85,7 +86,7 @@ private:
 
 private:
     PersonalizationModel *m_model;
-    Appearance           *m_dbus;
+    SharedDBusProxy<Appearance> m_dbus;
     WMSwitcher *m_wmSwitcher;
     WM *m_wm;
     Effects *m_effects;
@@ -0,0 +1,57 @@
+// SPDX-FileCopyrightText: 2022 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include "pinyinconverter.h"
+
+#include <DPinyin>
+
+#include <QHash>
+#include <QMutex>
+#include <QMutexLocker>
+
+using namespace dcc;
+
+QString PinyinConverter::full(const QString &text)
+{
+    QString full;
+    QString initials;
+    convert(text, full, initials);
+    return full;
+}
+
+void PinyinConverter::convert(const QString &text, QString &full, QString &initials)
+{
+    for (const QChar &ch : text) {
+        if (ch.script() != QChar::Script_Han) {
+            full.append(ch);
+            continue;
+        }
+
+        const QString &value = syllable(ch);
+        full.append(value);
+        if (!value.isEmpty())
+            initials.append(value.at(0));
+    }
+}
+
+QString PinyinConverter::syllable(const QChar &ch)
+{
+    static QMutex mutex;
+    static QHash<QChar, QString> cache; // 汉字 -> 不带声调的拼音
+
+    QMutexLocker locker(&mutex);
+    auto it = cache.constFind(ch);
+    if (it != cache.cend())
+        return it.value();
+
+    // 去除声调数字
+    QString value;
+    for (const QChar &c : DTK_CORE_NAMESPACE::Chinese2Pinyin(QString(ch)).toLower()) {
+        if (!c.isDigit())
+            value.append(c);
+    }
+
+    cache.insert(ch, value);
+    return value;
+}
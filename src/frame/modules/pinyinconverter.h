@@ -0,0 +1,29 @@
+// SPDX-FileCopyrightText: 2022 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#ifndef PINYINCONVERTER_H
+#define PINYINCONVERTER_H
+
+#include <QString>
+
+namespace dcc {
+
+// 汉字转拼音
+// 逐字调用 DTK 的 Chinese2Pinyin 并去除声调，结果按字缓存在进程内共享，可以在任意线程中使用
+class PinyinConverter
+{
+public:
+    // 返回 text 的全拼，非汉字原样保留
+    static QString full(const QString &text);
+    // full 追加 text 的全拼(非汉字原样保留)，initials 追加其中汉字的拼音首字母
+    static void convert(const QString &text, QString &full, QString &initials);
+
+private:
+    // 单个汉字不带声调的小写拼音
+    static QString syllable(const QChar &ch);
+};
+
+}
+
+#endif // PINYINCONVERTER_H
@@ -19,13 +19,11 @@ using namespace dcc::power;
 PowerWorker::PowerWorker(PowerModel *model, QObject *parent)
     : QObject(parent)
     , m_powerModel(model)
-    , m_powerInter(new PowerInter("com.deepin.daemon.Power", "/com/deepin/daemon/Power", QDBusConnection::sessionBus(), this))
-    , m_sysPowerInter(new SysPowerInter("com.deepin.system.Power", "/com/deepin/system/Power", QDBusConnection::systemBus(), this))
+    , m_powerInter(DBusProxyRegistry::get<PowerInter>("com.deepin.daemon.Power", "/com/deepin/daemon/Power", QDBusConnection::sessionBus()))
+    , m_sysPowerInter(DBusProxyRegistry::get<SysPowerInter>("com.deepin.system.Power", "/com/deepin/system/Power", QDBusConnection::systemBus()))
     , m_login1ManagerInter(new Login1ManagerInter("org.freedesktop.login1", "/org/freedesktop/login1", QDBusConnection::systemBus(), this))
     , m_powerManager(new PowerManager("com.deepin.daemon.PowerManager", "/com/deepin/daemon/PowerManager", QDBusConnection::systemBus(), this))
 {
-    m_powerInter->setSync(false);
-    m_sysPowerInter->setSync(false);
     m_login1ManagerInter->setSync(false);
 
     connect(m_powerInter, &PowerInter::ScreenBlackLockChanged, m_powerModel, &PowerModel::setScreenBlackLock);
@@ -98,8 +96,6 @@ PowerWorker::PowerWorker(PowerModel *model, QObject *parent)
 
 void PowerWorker::active()
 {
-    m_powerInter->blockSignals(false);
-
     // refersh data
     m_powerModel->setScreenBlackLock(m_powerInter->screenBlackLock());
     m_powerModel->setSleepLock(m_powerInter->sleepLock());
@@ -171,7 +167,7 @@ void PowerWorker::active()
 
 void PowerWorker::deactive()
 {
-    m_powerInter->blockSignals(true);
+    // 电源代理由多个模块共享，不能屏蔽其信号，active 时会重新同步全部数据
 }
 
 void PowerWorker::setScreenBlackLock(const bool lock)
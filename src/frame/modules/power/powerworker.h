@@ -5,6 +5,8 @@
 #ifndef POWERWORKER_H
 #define POWERWORKER_H
 
+#include "modules/dbusproxyregistry.h"
+
 #include <com_deepin_daemon_power.h>
 #include <com_deepin_system_systempower.h>
 #include <org_freedesktop_login1.h>
@@ -75,8 +77,8 @@ private:
 
 private:
     PowerModel *m_powerModel;
-    PowerInter *m_powerInter;
-    SysPowerInter *m_sysPowerInter;
+    SharedDBusProxy<PowerInter> m_powerInter;
+    SharedDBusProxy<SysPowerInter> m_sysPowerInter;
     Login1ManagerInter *m_login1ManagerInter;
     PowerManager *m_powerManager;
 };
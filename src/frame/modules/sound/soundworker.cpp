@@ -24,13 +24,31 @@ SoundWorker::SoundWorker(SoundModel *model, QObject *parent)
     , m_soundEffectInter(new SoundEffect("com.deepin.daemon.SoundEffect", "/com/deepin/daemon/SoundEffect", QDBusConnection::sessionBus(), this))
     , m_defaultSink(nullptr)
     , m_defaultSource(nullptr)
-    , m_powerInter(new SystemPowerInter("com.deepin.system.Power", "/com/deepin/system/Power", QDBusConnection::systemBus(), this))
+    , m_powerInter(DBusProxyRegistry::get<SystemPowerInter>("com.deepin.system.Power", "/com/deepin/system/Power", QDBusConnection::systemBus()))
     , m_dccSettings(new QGSettings("com.deepin.dde.control-center", QByteArray(), this))
     , m_pingTimer(new QTimer(this))
     , m_inter(QDBusConnection::sessionBus().interface())
 {
     m_audioInter->setSync(false);
-    m_powerInter->setSync(false);
+
+    // 拖动音量滑块时合并中间值，同一时刻只有一个 SetVolume 在途
+    m_sinkVolumeSetter = new CoalescingSetter([this](const QVariant &volume) {
+        if (!m_defaultSink)
+            return QDBusPendingCall::fromError(QDBusError(QDBusError::Failed, "no default sink"));
+
+        qDebug() << "set sink volume to " << volume.toDouble();
+        return QDBusPendingCall(m_defaultSink->SetVolume(volume.toDouble(), true));
+    }, this);
+    m_sinkVolumeSetter->setObjectName("SinkVolume");
+
+    m_sourceVolumeSetter = new CoalescingSetter([this](const QVariant &volume) {
+        if (!m_defaultSource)
+            return QDBusPendingCall::fromError(QDBusError(QDBusError::Failed, "no default source"));
+
+        qDebug() << "set source volume to " << volume.toDouble();
+        return QDBusPendingCall(m_defaultSource->SetVolume(volume.toDouble(), true));
+    }, this);
+    m_sourceVolumeSetter->setObjectName("SourceVolume");
 
     m_pingTimer->setInterval(5000);
     m_pingTimer->setSingleShot(false);
@@ -111,6 +129,10 @@ void SoundWorker::deactivate()
 {
     m_pingTimer->stop();
 
+    // 离开声音页面时输出本次拖动音量滑块的背压统计
+    m_sinkVolumeSetter->reportStatistics();
+    m_sourceVolumeSetter->reportStatistics();
+
     m_audioInter->blockSignals(true);
     if (m_defaultSink) m_defaultSink->blockSignals(true);
     if (m_defaultSource) m_defaultSource->blockSignals(true);
@@ -159,18 +181,14 @@ void SoundWorker::setSinkBalance(double balance)
 
 void SoundWorker::setSourceVolume(double volume)
 {
-    if (m_defaultSource) {
-        m_defaultSource->SetVolume(volume, true);
-        qDebug() << "set source volume to " << volume;
-    }
+    if (m_defaultSource)
+        m_sourceVolumeSetter->set(volume);
 }
 
 void SoundWorker::setSinkVolume(double volume)
 {
-    if (m_defaultSink) {
-        m_defaultSink->SetVolume(volume, true);
-        qDebug() << "set sink volume to " << volume;
-    }
+    if (m_defaultSink)
+        m_sinkVolumeSetter->set(volume);
 }
 
 //切换输入静音状态，flag为false时直接取消静音
@@ -240,6 +258,7 @@ void SoundWorker::defaultSinkChanged(const QDBusObjectPath &path)
 
     if (m_defaultSink)
         m_defaultSink->deleteLater();
+    m_sinkVolumeSetter->reset();
     m_defaultSink = new Sink("com.deepin.daemon.Audio", path.path(), QDBusConnection::sessionBus(), this);
 
     connect(m_defaultSink, &Sink::MuteChanged, [this](bool mute) { m_model->setSpeakerOn(mute);});
@@ -263,6 +282,7 @@ void SoundWorker::defaultSourceChanged(const QDBusObjectPath &path)
     if (path.path().isEmpty() || path.path() == "/" ) return; //路径为空
 
     if (m_defaultSource) m_defaultSource->deleteLater();
+    m_sourceVolumeSetter->reset();
     m_defaultSource = new Source("com.deepin.daemon.Audio", path.path(), QDBusConnection::sessionBus(), this);
 
     connect(m_defaultSource, &Source::MuteChanged, [this](bool mute) { m_model->setMicrophoneOn(mute); });
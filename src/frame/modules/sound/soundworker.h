@@ -15,6 +15,8 @@
 #include <com_deepin_system_systempower.h>
 
 #include "modules/moduleworker.h"
+#include "modules/coalescingsetter.h"
+#include "modules/dbusproxyregistry.h"
 #include "soundmodel.h"
 
 #include <DDesktopServices>
@@ -92,9 +94,11 @@ private:
     QPointer<Sink> m_defaultSink;
     QPointer<Source> m_defaultSource;
     QPointer<Meter> m_defaultSourceMeter;
+    CoalescingSetter *m_sinkVolumeSetter;
+    CoalescingSetter *m_sourceVolumeSetter;
     QList<Sink*> m_sinks;
     QList<Source*> m_sources;
-    SystemPowerInter *m_powerInter;
+    SharedDBusProxy<SystemPowerInter> m_powerInter;
     QGSettings *m_dccSettings;
     QMap<QDBusObjectPath, QPointer<Meter> > m_sourceMeterMap;
 
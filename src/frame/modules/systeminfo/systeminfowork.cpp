@@ -7,6 +7,7 @@
 #include "widgets/basiclistdelegate.h"
 #include "dsysinfo.h"
 #include "window/utils.h"
+#include "modules/dbuspropertysnapshot.h"
 
 #include <QFutureWatcher>
 #include <QtConcurrent>
@@ -28,11 +29,6 @@ SystemInfoWork::SystemInfoWork(SystemInfoModel *model, QObject *parent)
                                             QDBusConnection::sessionBus(), this);
     m_systemInfoInter->setSync(false);
 
-    m_systemInfo = new QDBusInterface("com.deepin.system.SystemInfo",
-                                      "/com/deepin/system/SystemInfo",
-                                      "com.deepin.system.SystemInfo",
-                                      QDBusConnection::systemBus(), this);
-
     m_dbusGrub = new GrubDbus("com.deepin.daemon.Grub2",
                               "/com/deepin/daemon/Grub2",
                               QDBusConnection::systemBus(),
@@ -140,9 +136,15 @@ SystemInfoWork::SystemInfoWork(SystemInfoModel *model, QObject *parent)
 void SystemInfoWork::activate()
 {
     qRegisterMetaType<ActiveState>("ActiveState");
-    m_model->setDistroID(m_systemInfoInter->distroID());
-    m_model->setDistroVer(m_systemInfoInter->distroVer());
-    m_model->setDisk(m_systemInfoInter->diskCap());
+    DBusPropertySnapshot *snapshot = new DBusPropertySnapshot(m_systemInfoInter, this);
+    connect(snapshot, &DBusPropertySnapshot::ready, this, [this, snapshot] {
+        m_model->setDistroID(snapshot->value<QString>("DistroID"));
+        m_model->setDistroVer(snapshot->value<QString>("DistroVer"));
+        m_model->setDisk(snapshot->value<qulonglong>("DiskCap"));
+        snapshot->deleteLater();
+    });
+    connect(snapshot, &DBusPropertySnapshot::failed, snapshot, &DBusPropertySnapshot::deleteLater);
+    snapshot->fetch();
 
     if (DSysInfo::uosType() == DSysInfo::UosType::UosServer ||
             (DSysInfo::uosType() == DSysInfo::UosType::UosDesktop)) {
@@ -169,11 +171,20 @@ void SystemInfoWork::activate()
     }
     m_model->setType(QSysInfo::WordSize);
 
-    if (m_systemInfo->isValid()) {
-        m_model->setMemory(static_cast<qulonglong>(DSysInfo::memoryTotalSize()), m_systemInfo->property("MemorySize").toULongLong());
-    } else {
+    // 系统服务不可用时退回到 DSysInfo 的安装内存大小
+    DBusPropertySnapshot *systemSnapshot = new DBusPropertySnapshot("com.deepin.system.SystemInfo",
+                                                                    "/com/deepin/system/SystemInfo",
+                                                                    "com.deepin.system.SystemInfo",
+                                                                    QDBusConnection::systemBus(), this);
+    connect(systemSnapshot, &DBusPropertySnapshot::ready, this, [this, systemSnapshot] {
+        m_model->setMemory(static_cast<qulonglong>(DSysInfo::memoryTotalSize()), systemSnapshot->value<qulonglong>("MemorySize"));
+        systemSnapshot->deleteLater();
+    });
+    connect(systemSnapshot, &DBusPropertySnapshot::failed, this, [this, systemSnapshot] {
         m_model->setMemory(static_cast<qulonglong>(DSysInfo::memoryTotalSize()), static_cast<qulonglong>(DSysInfo::memoryInstalledSize()));
-    }
+        systemSnapshot->deleteLater();
+    });
+    systemSnapshot->fetch();
 }
 
 void SystemInfoWork::deactivate()
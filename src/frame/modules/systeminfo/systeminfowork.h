@@ -67,7 +67,6 @@ private:
     GrubDbus* m_dbusGrub;
     GrubThemeDbus *m_dbusGrubTheme;
     HostNameDbus *m_dbusHostName;
-    QDBusInterface *m_systemInfo;
 };
 
 }
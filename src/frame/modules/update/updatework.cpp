@@ -109,12 +109,9 @@ UpdateWorker::UpdateWorker(UpdateModel *model, QObject *parent)
     , m_lastoresessionHelper(nullptr)
     , m_updateInter(nullptr)
     , m_managerInter(nullptr)
-    , m_powerInter(nullptr)
-    , m_powerSystemInter(nullptr)
     , m_networkInter(nullptr)
     , m_smartMirrorInter(nullptr)
     , m_abRecoveryInter(nullptr)
-    , m_iconTheme(nullptr)
     , m_onBattery(true)
     , m_batteryPercentage(0.0)
     , m_batterySystemPercentage(0.0)
@@ -147,20 +144,17 @@ void UpdateWorker::init()
     m_lastoresessionHelper = new LastoressionHelper("com.deepin.LastoreSessionHelper", "/com/deepin/LastoreSessionHelper", QDBusConnection::sessionBus(), this);
     m_updateInter = new UpdateInter("com.deepin.lastore", "/com/deepin/lastore", QDBusConnection::systemBus(), this);
     m_managerInter = new ManagerInter("com.deepin.lastore", "/com/deepin/lastore", QDBusConnection::systemBus(), this);
-    m_powerInter = new PowerInter("com.deepin.daemon.Power", "/com/deepin/daemon/Power", QDBusConnection::sessionBus(), this);
-    m_powerSystemInter = new PowerSystemInter("com.deepin.system.Power", "/com/deepin/system/Power", QDBusConnection::systemBus(), this);
+    m_powerInter = DBusProxyRegistry::get<PowerInter>("com.deepin.daemon.Power", "/com/deepin/daemon/Power", QDBusConnection::sessionBus());
+    m_powerSystemInter = DBusProxyRegistry::get<PowerSystemInter>("com.deepin.system.Power", "/com/deepin/system/Power", QDBusConnection::systemBus());
     m_networkInter = new Network("com.deepin.daemon.Network", "/com/deepin/daemon/Network", QDBusConnection::sessionBus(), this);
     m_smartMirrorInter = new SmartMirrorInter("com.deepin.lastore.Smartmirror", "/com/deepin/lastore/Smartmirror", QDBusConnection::systemBus(), this);
     m_abRecoveryInter = new RecoveryInter("com.deepin.ABRecovery", "/com/deepin/ABRecovery", QDBusConnection::systemBus(), this);
-    m_iconTheme = new Appearance("com.deepin.daemon.Appearance", "/com/deepin/daemon/Appearance", QDBusConnection::sessionBus(), this);
+    m_iconTheme = DBusProxyRegistry::get<Appearance>("com.deepin.daemon.Appearance", "/com/deepin/daemon/Appearance", QDBusConnection::sessionBus());
 
     m_managerInter->setSync(false);
     m_updateInter->setSync(false);
-    m_powerInter->setSync(false);
-    m_powerSystemInter->setSync(false);
     m_lastoresessionHelper->setSync(false);
     m_smartMirrorInter->setSync(false, false);
-    m_iconTheme->setSync(false);
 
     QString sVersion = QString("%1 %2").arg(DSysInfo::uosProductTypeName()).arg(DSysInfo::majorVersion());
     if (!IsServerSystem)
@@ -331,13 +325,17 @@ void UpdateWorker::activate()
         iconWatcher->deleteLater();
     });
 
+    // 共享代理属于主线程，不能在其他线程中切换同步模式，这里直接读取属性
+    const QString service = m_iconTheme->service();
+    const QString path = m_iconTheme->path();
     iconWatcher->setFuture(QtConcurrent::run([ = ] {
-        bool isSync = m_iconTheme->sync();
-        m_iconTheme->setSync(true);
-        const QString &iconTheme = m_iconTheme->iconTheme();
-        m_iconTheme->setSync(isSync);
-        return iconTheme;
+        QDBusMessage msg = QDBusMessage::createMethodCall(service, path, "org.freedesktop.DBus.Properties", "Get");
+        msg << Appearance::staticInterfaceName() << QStringLiteral("IconTheme");
+        QDBusReply<QDBusVariant> reply = QDBusConnection::sessionBus().call(msg);
+        return reply.isValid() ? reply.value().variant().toString() : QString();
     }));
+
+    Q_EMIT activated();
 }
 
 void UpdateWorker::deactivate()
@@ -6,6 +6,7 @@
 #define UPDATEWORK_H
 
 #include "updatemodel.h"
+#include "modules/dbusproxyregistry.h"
 
 #include <QObject>
 #include <QNetworkAccessManager>
@@ -96,6 +97,8 @@ public:
 Q_SIGNALS:
     void requestInit();
     void requestActive();
+    // activate 中的同步读取完成，模型已有初始状态
+    void activated();
     void requestRefreshLicenseState();
 
 #ifndef DISABLE_SYS_UPDATE_MIRRORS
@@ -217,12 +220,12 @@ private:
     LastoressionHelper *m_lastoresessionHelper;
     UpdateInter *m_updateInter;
     ManagerInter *m_managerInter;
-    PowerInter *m_powerInter;
-    PowerSystemInter *m_powerSystemInter;
+    SharedDBusProxy<PowerInter> m_powerInter;
+    SharedDBusProxy<PowerSystemInter> m_powerSystemInter;
     Network *m_networkInter;
     SmartMirrorInter *m_smartMirrorInter;
     RecoveryInter *m_abRecoveryInter;
-    Appearance *m_iconTheme;
+    SharedDBusProxy<Appearance> m_iconTheme;
     bool m_onBattery;
     double m_batteryPercentage;
     double m_batterySystemPercentage;
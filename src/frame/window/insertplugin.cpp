@@ -5,6 +5,9 @@
 #include "insertplugin.h"
 
 #include <QGSettings>
+#include <QJsonDocument>
+#include <QStandardPaths>
+#include <QSaveFile>
 
 #include <DStandardItem>
 
@@ -13,9 +16,35 @@ const QString ModuleDirectory = "/usr/lib/dde-control-center/modules";
 using namespace DCC_NAMESPACE;
 DWIDGET_USE_NAMESPACE
 
+namespace {
+// 只携带缓存元数据的模块，用于插件未加载时注册搜索路径
+class PluginMetaData : public ModuleInterface
+{
+public:
+    explicit PluginMetaData(const Plugin *plugin) : m_plugin(plugin) {}
+
+    void initialize() override {}
+    const QString name() const override { return m_plugin->name; }
+    const QString displayName() const override { return m_plugin->displayName; }
+    QIcon icon() const override { return QIcon::fromTheme(m_plugin->icon); }
+    QString translationPath() const override { return m_plugin->translation; }
+
+private:
+    const Plugin *m_plugin;
+};
+
+QString manifestPath()
+{
+    return QStandardPaths::writableLocation(QStandardPaths::GenericCacheLocation)
+           + "/deepin/dde-control-center/plugins.json";
+}
+}
+
 QPointer<InsertPlugin> InsertPlugin::INSTANCE = nullptr;
 
 InsertPlugin::InsertPlugin(QObject *obj, FrameProxyInterface *frameProxy)
+    : m_parent(obj)
+    , m_frameProxy(frameProxy)
 {
     QDir moduleDir(ModuleDirectory);
     if (!moduleDir.exists())
@@ -24,6 +53,9 @@ InsertPlugin::InsertPlugin(QObject *obj, FrameProxyInterface *frameProxy)
         return;
     }
 
+    const QJsonObject &cached = readManifest();
+    const QString &locale = QLocale::system().name();
+
     auto moduleList = moduleDir.entryInfoList();
     for (auto i : moduleList)
     {
@@ -32,59 +64,185 @@ InsertPlugin::InsertPlugin(QObject *obj, FrameProxyInterface *frameProxy)
         if (!QLibrary::isLibrary(path))
             continue;
 
-        qDebug() << "loading module: " << i;
+        Plugin *plugin = new Plugin;
+        plugin->file = path;
 
-        QElapsedTimer et;
-        et.start();
-        QPluginLoader loader(path);
-        const QJsonObject &meta = loader.metaData().value("MetaData").toObject();
-        if (!compareVersion(meta.value("api").toString(), "1.0.0"))
+        // 库文件及语言未变化时直接使用缓存的元数据，插件在首次使用时才加载
+        const QJsonObject &cache = cached.value(path).toObject();
+        if (cache.value("mtime").toVariant().toLongLong() == i.lastModified().toMSecsSinceEpoch()
+                && cache.value("size").toVariant().toLongLong() == i.size()
+                && cache.value("locale").toString() == locale
+                && !cache.value("name").toString().isEmpty())
         {
-            qDebug() << "plugin's version is too low";
-            continue;
-        }
+            if (!compareVersion(cache.value("api").toString(), "1.0.0"))
+            {
+                qDebug() << "plugin's version is too low";
+                delete plugin;
+                continue;
+            }
 
-        QObject *instance = loader.instance();
-        if (!instance)
-        {
-            qDebug() << loader.errorString();
-            continue;
+            plugin->path = cache.value("path").toString();
+            plugin->follow = cache.value("follow").toString();
+            plugin->enabled = cache.value("enabled").toBool();
+            plugin->name = cache.value("name").toString();
+            plugin->displayName = cache.value("displayName").toString();
+            plugin->icon = cache.value("icon").toString();
+            plugin->translation = cache.value("translation").toString();
+            m_manifest.insert(path, cache);
         }
+        else
+        {
+            qDebug() << "loading module: " << i;
+            QPluginLoader loader(path);
+            const QString &api = loader.metaData().value("MetaData").toObject().value("api").toString();
+            if (!compareVersion(api, "1.0.0"))
+            {
+                qDebug() << "plugin's version is too low";
+                delete plugin;
+                continue;
+            }
 
-        instance->setParent(obj);
+            if (!loadPlugin(plugin))
+            {
+                delete plugin;
+                continue;
+            }
 
-        auto *module = qobject_cast<ModuleInterface *>(instance);
-        if (!module)
+            QJsonObject entry = m_manifest.value(path).toObject();
+            entry.insert("mtime", i.lastModified().toMSecsSinceEpoch());
+            entry.insert("size", i.size());
+            entry.insert("locale", locale);
+            entry.insert("api", api);
+            m_manifest.insert(path, entry);
+        }
+
+        // 一级菜单插件需要直接插入导航列表，图标不是主题图标时无法缓存，这两种情况仍在启动时加载
+        if ((plugin->path == MAINWINDOW || plugin->icon.isEmpty()) && !loadPlugin(plugin))
         {
-            return;
+            delete plugin;
+            continue;
         }
-        qDebug() << "load plugin Name: " << module->name() << module->displayName();
-        qDebug() << "load this plugin using time: " << et.elapsed() << "ms";
-        module->setFrameProxy(frameProxy);
 
-        if (module->follow() != MAINWINDOW && frameProxy)
+        if (plugin->follow != MAINWINDOW && frameProxy)
         {
-            frameProxy->setSearchPath(module);
+            if (plugin->instance)
+            {
+                frameProxy->setSearchPath(qobject_cast<ModuleInterface *>(plugin->instance));
+            }
+            else
+            {
+                PluginMetaData meta(plugin);
+                frameProxy->setSearchPath(&meta);
+            }
         }
 
-        Plugin plugin;
-        plugin.path = module->path();
-        plugin.follow = module->follow();
-        plugin.enabled = module->enabled();
+        m_allModules.push_back(plugin);
+    }
+
+    // 已卸载插件的缓存随之丢弃
+    if (m_manifest != cached)
+        writeManifest();
+}
+
+InsertPlugin::~InsertPlugin()
+{
+    qDeleteAll(m_allModules);
+}
+
+ModuleInterface *InsertPlugin::loadPlugin(Plugin *plugin)
+{
+    if (plugin->instance)
+        return qobject_cast<ModuleInterface *>(plugin->instance);
+
+    QElapsedTimer et;
+    et.start();
+    QPluginLoader loader(plugin->file);
+    QObject *instance = loader.instance();
+    if (!instance)
+    {
+        qDebug() << loader.errorString();
+        return nullptr;
+    }
+
+    auto *module = qobject_cast<ModuleInterface *>(instance);
+    if (!module)
+    {
+        delete instance;
+        return nullptr;
+    }
+
+    instance->setParent(m_parent);
+    qDebug() << "load plugin Name: " << module->name() << module->displayName();
+    qDebug() << "load this plugin using time: " << et.elapsed() << "ms";
+    module->setFrameProxy(m_frameProxy);
+
+    plugin->instance = instance;
+    plugin->path = module->path();
+    plugin->follow = module->follow();
+    plugin->enabled = module->enabled();
+    plugin->name = module->name();
+    plugin->displayName = module->displayName();
+    plugin->icon = module->icon().name();
+    plugin->translation = module->translationPath();
+    updateManifest(plugin);
+
+    return module;
+}
+
+QJsonObject InsertPlugin::readManifest() const
+{
+    QFile file(manifestPath());
+    if (!file.open(QIODevice::ReadOnly))
+        return QJsonObject();
 
-        m_allModules.push_back({plugin, {instance, module->name()}});
+    return QJsonDocument::fromJson(file.readAll()).object();
+}
+
+void InsertPlugin::writeManifest() const
+{
+    const QString &path = manifestPath();
+    QDir().mkpath(QFileInfo(path).absolutePath());
+
+    QSaveFile file(path);
+    if (!file.open(QIODevice::WriteOnly))
+    {
+        qWarning() << "failed to write plugin manifest:" << path;
+        return;
     }
+
+    file.write(QJsonDocument(m_manifest).toJson(QJsonDocument::Compact));
+    file.commit();
+}
+
+void InsertPlugin::updateManifest(const Plugin *plugin)
+{
+    QJsonObject entry = m_manifest.value(plugin->file).toObject();
+    entry.insert("path", plugin->path);
+    entry.insert("follow", plugin->follow);
+    entry.insert("enabled", plugin->enabled);
+    entry.insert("name", plugin->name);
+    entry.insert("displayName", plugin->displayName);
+    entry.insert("icon", plugin->icon);
+    entry.insert("translation", plugin->translation);
+
+    if (entry == m_manifest.value(plugin->file).toObject())
+        return;
+
+    m_manifest.insert(plugin->file, entry);
+    // 启动扫描时统一写入，之后按需加载的插件元数据变化时立即写入
+    if (m_allModules.contains(plugin))
+        writeManifest();
 }
 
 bool InsertPlugin::updatePluginInfo(QString moduleName)
 {
     m_currentPlugins.clear();
 
-    for (auto pluginSetting : m_allModules)
+    for (Plugin *plugin : m_allModules)
     {
-        if (pluginSetting.first.path == moduleName)
+        if (plugin->path == moduleName)
         {
-            m_currentPlugins << pluginSetting;
+            m_currentPlugins << plugin;
         }
     }
 
@@ -101,13 +259,14 @@ InsertPlugin *InsertPlugin::instance(QObject *obj, FrameProxyInterface *FramePro
 
 void InsertPlugin::preInitialize(QString moduleName)
 {
-    for (auto pluginSetting : m_allModules)
+    for (Plugin *plugin : m_allModules)
     {
-        if (pluginSetting.first.path == moduleName)
+        if (plugin->path == moduleName)
         {
-            auto *module = qobject_cast<ModuleInterface *>(pluginSetting.second.first);
+            auto *module = loadPlugin(plugin);
             // 调用模块初始化函数搜索数据
-            module->preInitialize(false);
+            if (module)
+                module->preInitialize(false);
             break;
         }
     }
@@ -115,11 +274,10 @@ void InsertPlugin::preInitialize(QString moduleName)
 
 ModuleInterface *InsertPlugin::pluginInterface(const QString &displayName)
 {
-    for (const auto &plugin : m_currentPlugins)
+    for (Plugin *plugin : m_currentPlugins)
     {
-        auto *module = qobject_cast<ModuleInterface *>(plugin.second.first);
-        if (module->name() == displayName)
-            return module;
+        if (plugin->name == displayName)
+            return loadPlugin(plugin);
     }
     return nullptr;
 }
@@ -133,21 +291,23 @@ void dccV20::InsertPlugin::pushPlugin(QList<QPair<dccV20::ModuleInterface *, QSt
     // 一级菜单插件配置mainwindow
     for (int i = 0; i < m_currentPlugins.size(); i++)
     {
-        auto *module = qobject_cast<ModuleInterface *>(m_currentPlugins.at(i).second.first);
-
         // 查看插件是否定义为可用
-        if (!m_currentPlugins.at(i).first.enabled)
+        if (!m_currentPlugins.at(i)->enabled)
+            continue;
+
+        auto *module = loadPlugin(m_currentPlugins.at(i));
+        if (!module)
             continue;
 
         // index类型,字符串就插入模块名字的后面(这个目前不方便汉化,直接配置对应模块的名字),数字就直接插入对应的位置，空值默认添加到最后
         bool ok;
-        int index = m_currentPlugins.at(i).first.follow.toInt(&ok);
+        int index = m_currentPlugins.at(i)->follow.toInt(&ok);
 
         // 类型为字符串时
         if (!ok)
         {
             // 字符串为空时，默认置底
-            if (m_currentPlugins.at(i).first.follow.isEmpty())
+            if (m_currentPlugins.at(i)->follow.isEmpty())
             {
                 modules.append({module, module->displayName()});
                 return;
@@ -155,7 +315,7 @@ void dccV20::InsertPlugin::pushPlugin(QList<QPair<dccV20::ModuleInterface *, QSt
 
             // 遍历modules查找插入位置
             auto res = std::find_if(modules.begin(), modules.end(), [=](const QPair<ModuleInterface *, QString> &data) -> bool
-                                    { return data.first->name() == m_currentPlugins.at(i).first.follow; });
+                                    { return data.first->name() == m_currentPlugins.at(i)->follow; });
 
             // 若未找到则不添加插件
             if (res != modules.end())
@@ -185,19 +345,22 @@ void dccV20::InsertPlugin::pushPlugin(QStandardItemModel *Model, QList<dccV20::L
 {
     for (int i = 0; i < m_currentPlugins.size(); i++)
     {
+        // 查看插件是否定义为可用
+        if (!m_currentPlugins.at(i)->enabled)
+            continue;
+
+        auto *module = loadPlugin(m_currentPlugins.at(i));
+        if (!module)
+            continue;
+
         QByteArray normalizedSignature = QMetaObject::normalizedSignature("active()");
-        int methodIndex = m_currentPlugins.at(i).second.first->metaObject()->indexOfMethod(normalizedSignature);
+        int methodIndex = m_currentPlugins.at(i)->instance->metaObject()->indexOfMethod(normalizedSignature);
         // 找不到对应激活的方法
         if (methodIndex == -1)
         {
             continue;
         }
 
-        // 查看插件是否定义为可用
-        if (!m_currentPlugins.at(i).first.enabled)
-            continue;
-
-        auto *module = qobject_cast<ModuleInterface *>(m_currentPlugins.at(i).second.first);
         // 调用模块初始化函数
         module->preInitialize(false);
         module->initialize();
@@ -207,10 +370,10 @@ void dccV20::InsertPlugin::pushPlugin(QStandardItemModel *Model, QList<dccV20::L
         item->setText(module->displayName());
 
         // active方法
-        QMetaMethod metaMethod = m_currentPlugins.at(i).second.first->metaObject()->method(methodIndex);
+        QMetaMethod metaMethod = m_currentPlugins.at(i)->instance->metaObject()->method(methodIndex);
 
         bool ok;
-        int index = m_currentPlugins.at(i).first.follow.toInt(&ok);
+        int index = m_currentPlugins.at(i)->follow.toInt(&ok);
 
         //二级菜单插件的位置，为非数字默认置底
         if (ok)
@@ -218,13 +381,13 @@ void dccV20::InsertPlugin::pushPlugin(QStandardItemModel *Model, QList<dccV20::L
             if (index > Model->rowCount())
             {
                 itemList.append({module->name(), module->displayName(),
-                                 metaMethod, m_currentPlugins.at(i).second.first});
+                                 metaMethod, m_currentPlugins.at(i)->instance});
                 Model->appendRow(item);
             }
             else
             {
                 itemList.insert(index - 1, {module->name(), module->displayName(),
-                                            metaMethod, m_currentPlugins.at(i).second.first});
+                                            metaMethod, m_currentPlugins.at(i)->instance});
                 Model->insertRow(index - 1, item);
             }
         }
@@ -233,10 +396,10 @@ void dccV20::InsertPlugin::pushPlugin(QStandardItemModel *Model, QList<dccV20::L
             bool isLoad = false;
             for (int k = 0; k < Model->rowCount(); k++)
             {
-                if (Model->item(k)->text() == m_currentPlugins.at(i).first.follow)
+                if (Model->item(k)->text() == m_currentPlugins.at(i)->follow)
                 {
                     itemList.insert(k + 1, {module->name(), module->displayName(),
-                                            metaMethod, m_currentPlugins.at(i).second.first});
+                                            metaMethod, m_currentPlugins.at(i)->instance});
                     Model->insertRow(k + 1, item);
                     isLoad = true;
                     break;
@@ -245,7 +408,7 @@ void dccV20::InsertPlugin::pushPlugin(QStandardItemModel *Model, QList<dccV20::L
             if (!isLoad)
             {
                 itemList.append({module->name(), module->displayName(),
-                                 metaMethod, m_currentPlugins.at(i).second.first});
+                                 metaMethod, m_currentPlugins.at(i)->instance});
                 Model->appendRow(item);
             }
         }
@@ -262,12 +425,12 @@ QStringList InsertPlugin::availPages(const QString &moduleName)
     updatePluginInfo(moduleName);
 
     QStringList pages;
-    for (auto it : m_currentPlugins)
+    for (const Plugin *it : m_currentPlugins)
     {
-        if (it.first.path != moduleName)
+        if (it->path != moduleName)
             continue;
 
-        QString name = it.second.second;
+        QString name = it->name;
         pages.append(name);
     }
 
@@ -22,6 +22,12 @@ namespace DCC_NAMESPACE
         QString path;   // 插件级别及二级菜单插件所属模块
         QString follow; // 插件插入位置，可以字符串或者数字
         bool enabled;   // 插件是否处于可用状态
+        QString file;        // 插件库文件路径
+        QString name;        // 插件模块名
+        QString displayName; // 插件显示名称
+        QString icon;        // 插件图标主题名，为空时无法缓存，需要在启动时加载插件
+        QString translation; // 插件搜索翻译文件路径
+        QObject *instance{nullptr}; // 插件对象，首次使用时才加载
     };
 
     class InsertPlugin : public QObject
@@ -29,6 +35,7 @@ namespace DCC_NAMESPACE
         Q_OBJECT
     public:
         InsertPlugin(QObject *parent, FrameProxyInterface *interface);
+        ~InsertPlugin() override;
         // 查询改模块是否需要加载插件
         bool updatePluginInfo(QString moduleName);
         // 一级菜单插入插件
@@ -44,12 +51,23 @@ namespace DCC_NAMESPACE
         // 获取对应displayName的插件对象
         ModuleInterface *pluginInterface(const QString &displayName);
 
+    private:
+        // 加载插件库并创建插件对象，已加载时直接返回
+        ModuleInterface *loadPlugin(Plugin *plugin);
+        QJsonObject readManifest() const;
+        void writeManifest() const;
+        void updateManifest(const Plugin *plugin);
+
     private:
         static QPointer<InsertPlugin> INSTANCE;
-        // 保存加载的所有插件
-        QList<QPair<Plugin, QPair<QObject *, QString>>> m_allModules;
+        QObject *m_parent;
+        FrameProxyInterface *m_frameProxy;
+        // 保存发现的所有插件
+        QList<Plugin *> m_allModules;
         // 保存插入到某个模块的所有插件
-        QList<QPair<Plugin, QPair<QObject *, QString>>> m_currentPlugins;
+        QList<Plugin *> m_currentPlugins;
+        // 插件元数据缓存，以插件库路径为键，库文件修改时间、大小及语言不变时可直接使用
+        QJsonObject m_manifest;
     };
 }
 #endif // INSERTPLUGIN_H
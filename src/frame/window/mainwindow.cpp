@@ -29,8 +29,10 @@
 #include "widgets/multiselectlistview.h"
 #include "mainwindow.h"
 #include "insertplugin.h"
+#include "moduleregistry.h"
 #include "constant.h"
 #include "search/searchwidget.h"
+#include "search/grandsearchquery.h"
 #include "dtitlebar.h"
 #include "utils.h"
 #include "interface/moduleinterface.h"
@@ -68,8 +70,6 @@ const QByteArray ControlCenterGSettings = "com.deepin.dde.control-center";
 const QString GSettinsWindowWidth = "window-width";
 const QString GSettinsWindowHeight = "window-height";
 const QString ModuleDirectory = "/usr/lib/dde-control-center/modules";
-const QString ControlCenterIconPath = "/usr/share/icons/bloom/apps/64/preferences-system.svg";
-const QString ControlCenterGroupName = "com.deepin.dde-grand-search.group.dde-control-center-setting";
 
 const int WidgetMinimumWidth = 820;
 const int WidgetMinimumHeight = 634;
@@ -95,6 +95,7 @@ MainWindow::MainWindow(QWidget *parent)
     , m_navView(nullptr)
     , m_rightView(nullptr)
     , m_navModel(nullptr)
+    , m_moduleRegistry(new ModuleRegistry(this))
     , m_bIsFinalWidget(false)
     , m_bIsFromSecondAddWidget(false)
     , m_topWidget(nullptr)
@@ -378,6 +379,17 @@ void MainWindow::initAllModule(const QString &m)
     if (showSyncModule()) {
          m_modules.insert(3, {new SyncModule(this), DSysInfo::isCommunityEdition() ? "Deepin ID" : "UOS ID"});
     }
+
+    // 以下模块的导航栏可见性依赖设备或服务状态(display 还需为主窗口提供主屏信息)，仍在启动时预初始化
+    // 其余内置模块延迟到首次使用时再创建 worker/model；插件行为未知，不登记延迟加载
+    const QStringList eagerModules { "authentication", "bluetooth", "cloudsync", "commoninfo", "display", "touchscreen", "update", "wacom" };
+    for (auto it = m_modules.cbegin(); it != m_modules.cend(); ++it) {
+        if (!eagerModules.contains(it->first->name()))
+            m_moduleRegistry->registerLazy(it->first);
+    }
+    // 触摸屏与显示模块使用同一个 Display 服务的显示器数据
+    m_moduleRegistry->addDependency("touchscreen", "display");
+
     //读取加载一级菜单的插件
     if (InsertPlugin::instance(this, this)->updatePluginInfo("mainwindow"))
         InsertPlugin::instance()->pushPlugin(m_modules);
@@ -430,10 +442,24 @@ void MainWindow::initAllModule(const QString &m)
 
         m_navModel->appendRow(item);
         m_searchWidget->addModulesName(it->first->name(), it->second, it->first->icon(), it->first->translationPath());
+        if (it->first->name() != m)
+            m_searchWidget->setModuleDeferred(it->second, true);
     }
 
     resetNavList(isIcon);
 
+    // 模块完成预初始化后，由模块自身接管搜索数据的可见性，并刷新其导航栏可见性
+    connect(m_moduleRegistry, &ModuleRegistry::modulePreInitialized, this, [this](ModuleInterface *inter) {
+        auto find_it = std::find_if(m_modules.cbegin(), m_modules.cend(), [inter](const QPair<ModuleInterface *, QString> &pair) {
+            return pair.first == inter;
+        });
+        if (find_it == m_modules.cend())
+            return;
+
+        m_searchWidget->setModuleDeferred(find_it->second, false);
+        updateModuleVisible(*find_it);
+    });
+
     modulePreInitialize(m);
     updateModuleVisible();
 
@@ -482,29 +508,22 @@ void MainWindow::updateModuleVisible()
 {
     m_hideModuleNames = m_moduleSettings->get(GSETTINGS_HIDE_MODULE).toStringList();
     for (auto i : m_modules) {
+        updateModuleVisible(i);
+    }
+}
 
-        if (m_hideModuleNames.contains((i.first->name())) || i.first->deviceUnavailabel() || !i.first->isAvailable()) {
-            setModuleVisible(i.second, false);
-        } else if (i.first->isAvailable()) {
-            setModuleVisible(i.second, true);
-        }
+void MainWindow::updateModuleVisible(const QPair<ModuleInterface *, QString> &module)
+{
+    if (m_hideModuleNames.contains((module.first->name())) || module.first->deviceUnavailabel() || !module.first->isAvailable()) {
+        setModuleVisible(module.second, false);
+    } else if (module.first->isAvailable()) {
+        setModuleVisible(module.second, true);
     }
 }
 
 void MainWindow::modulePreInitialize(const QString &m)
 {
-    for (auto it = m_modules.cbegin(); it != m_modules.cend(); ++it) {
-        QElapsedTimer et;
-        et.start();
-        it->first->preInitialize(m == it->first->name());
-        qDebug() << QString("initialize %1 module using time: %2ms")
-                 .arg(it->first->name())
-                 .arg(et.elapsed());
-        if (it->first->isAvailable()) {
-            // 模块有效时先初始化模块和搜索数据
-            InsertPlugin::instance()->preInitialize(it->first->name());
-        }
-    }
+    m_moduleRegistry->preInitializeEager(m_modules, m);
 }
 
 void MainWindow::popWidget()
@@ -613,6 +632,8 @@ void MainWindow::showModulePage(const QString &module, const QString &page, bool
 
     auto pm = findModule(module);
     Q_ASSERT(pm);
+    // 可用页面可能依赖模块数据，需先完成预初始化
+    m_moduleRegistry->ensurePreInitialized(pm, true);
 
     qDebug() << page;
     QStringList pages = page.split(",");
@@ -687,6 +708,9 @@ bool MainWindow::isModuleAvailable(const QString &m)
     });
 
     if (res != m_modules.end()) {
+        // 排队中的模块需要在预初始化后才能确定是否可用
+        if (!m_moduleRegistry->isLazy((*res).first))
+            m_moduleRegistry->ensurePreInitialized((*res).first);
         return (*res).first->isAvailable();
     }
 
@@ -947,6 +971,26 @@ void MainWindow::resetNavList(bool isIconMode)
 }
 
 void MainWindow::onEnterSearchWidget(QString moduleName, QString widget)
+{
+    auto find_it = std::find_if(m_modules.cbegin(), m_modules.cend(), [moduleName](const QPair<ModuleInterface *, QString> &pair) {
+        return pair.first->name() == moduleName;
+    });
+    if (find_it == m_modules.cend()) {
+        qDebug() << Q_FUNC_INFO << "Not found module:" << moduleName;
+        return;
+    }
+
+    //模块预初始化完成后再进入页面，未初始化的模块在此同步初始化；预初始化后仍不可用的模块不再跳转
+    m_moduleRegistry->ensurePreInitialized(find_it->first, true);
+    if (!m_moduleRegistry->isPreInitialized(find_it->first) || !find_it->first->isAvailable()) {
+        qWarning() << Q_FUNC_INFO << "module is not available:" << moduleName;
+        return;
+    }
+
+    enterSearchWidget(moduleName, widget);
+}
+
+void MainWindow::enterSearchWidget(const QString &moduleName, const QString &widget)
 {
     QString widgetFirst = widget;
     if (widget.contains(','))
@@ -1302,6 +1346,7 @@ void MainWindow::onFirstItemClick(const QModelIndex &index)
     m_navView->setFocus();
     popAllWidgets();
 
+    m_moduleRegistry->ensurePreInitialized(inter);
     if (!m_initList.contains(inter)) {
         inter->initialize();
         m_initList << inter;
@@ -1396,55 +1441,13 @@ void MainWindow::setSearchPath(ModuleInterface *const inter) const
 
 QString MainWindow::GrandSearchSearch(const QString json)
 {
-    //解析输入的json值
-    QJsonDocument jsonDocument = QJsonDocument::fromJson(json.toLocal8Bit().data());
-    if(!jsonDocument.isNull()) {
-        QJsonObject jsonObject = jsonDocument.object();
-        m_lstGrandSearchTasks.append(jsonObject);
-
-        //处理搜索任务, 返回搜索结果
-        QList<QString> lstMsg = m_searchWidget->searchResults(jsonObject.value("cont").toString());
-
-        for(auto msg : lstMsg) {
-            qDebug() << "name:" << msg;
-        }
-
-        QJsonObject jsonResults;
-        QJsonArray items;
-        for (int i = 0; i < lstMsg.size(); i++) {
-            QJsonObject jsonObj;
-            jsonObj.insert("item", lstMsg[i]);
-            jsonObj.insert("name", lstMsg[i]);
-            jsonObj.insert("icon", ControlCenterIconPath);
-            jsonObj.insert("type", "application/x-dde-control-center-xx");
-
-            items.insert(i, jsonObj);
-        }
-
-        QJsonObject objCont;
-        objCont.insert("group",ControlCenterGroupName);
-        objCont.insert("items", items);
-
-        QJsonArray arrConts;
-        arrConts.insert(0, objCont);
-
-        jsonResults.insert("ver", jsonObject.value("ver"));
-        jsonResults.insert("mID", jsonObject.value("mID"));
-        jsonResults.insert("cont", arrConts);
-
-        QJsonDocument document;
-        document.setObject(jsonResults);
-        m_lstGrandSearchTasks.removeOne(jsonObject);
-
-        return document.toJson(QJsonDocument::Compact);
-   }
-
-    return QString();
+    return m_searchWidget->grandSearchQuery()->search(*this, json);
 }
 
 bool MainWindow::GrandSearchStop(const QString json)
 {
     Q_UNUSED(json)
+    m_searchWidget->grandSearchQuery()->stop(*this);
     return true;
 }
 
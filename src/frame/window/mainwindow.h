@@ -43,6 +43,7 @@ extern const QString GSettinsWindowHeight;
 
 namespace DCC_NAMESPACE {
 class ModuleInterface;
+class ModuleRegistry;
 class FourthColWidget : public QWidget
 {
     Q_OBJECT
@@ -84,6 +85,7 @@ public:
     void addChildPageTrans(const QString &menu, const QString &tran) override;
     virtual QString moduleDisplayName(const QString &module) const override;
 
+    // 大搜索适配器的 D-Bus 调用上下文由 Qt 设置在本对象上，由本对象判断是否延迟应答及调用者
     QString GrandSearchSearch(const QString json);
     bool GrandSearchStop(const QString json);
     bool GrandSearchAction(const QString json);
@@ -106,6 +108,7 @@ Q_SIGNALS:
 private:
     void changeEvent(QEvent *event) override;
     bool event(QEvent* event) override;
+    void enterSearchWidget(const QString &moduleName, const QString &widget);
 
 private Q_SLOTS:
     void onEnterSearchWidget(QString moduleName, QString widget);
@@ -137,6 +140,7 @@ private:
     void judgeTopWidgetPlace(ModuleInterface *const inter, QWidget *const w);
     void updateViewBackground();
     void updateModuleVisible();
+    void updateModuleVisible(const QPair<ModuleInterface *, QString> &module);
     bool showSyncModule();
 
 private:
@@ -149,6 +153,7 @@ private:
     QStack<QPair<ModuleInterface *, QWidget *>> m_contentStack;
     QList<QPair<ModuleInterface *, QString>> m_modules;
     QList<ModuleInterface *> m_initList;
+    ModuleRegistry *m_moduleRegistry;
     QPair<ModuleInterface *, QWidget *> m_lastThirdPage;
     bool m_bIsFinalWidget;//used to distinguish the widget is final or top : fianl pop in popWidget , top pop by m_topWidget
     bool m_bIsFromSecondAddWidget;//used to save the third widget is load from final widget
@@ -173,8 +178,6 @@ private:
     QSize m_lastSize;
     bool m_needRememberLastSize = true;     //用于判断是否需要上次resize的窗口大小
 
-    //全局搜索
-    QList<QJsonObject> m_lstGrandSearchTasks;
     QPointer<QScreen> m_primaryScreen;
     int m_currentIndex = -1;
     bool m_bIsNeedChange = false;
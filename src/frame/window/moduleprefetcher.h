@@ -0,0 +1,28 @@
+// SPDX-FileCopyrightText: 2022 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#ifndef MODULEPREFETCHER_H
+#define MODULEPREFETCHER_H
+
+#include "interface/namespace.h"
+
+#include <functional>
+
+namespace DCC_NAMESPACE {
+
+// 预初始化耗时主要在读取 dbus 数据的模块实现此接口，把预初始化拆成两步：
+// prefetch 在主线程上只发出异步请求(或交给模块的工作线程)后立即返回，数据全部取回后调用 done；
+// ModuleRegistry 同时启动各模块的 prefetch，再按取回的先后在主线程调用 preInitialize，用取回的数据创建 worker/model
+// 模块被使用、被依赖或等待超时时，可能在 prefetch 完成前就被预初始化，此时 preInitialize 需回退到同步获取
+// 独立于 ModuleInterface，插件接口不受影响
+class ModulePrefetcher
+{
+public:
+    virtual ~ModulePrefetcher() {}
+
+    virtual void prefetch(std::function<void()> done) = 0;
+};
+}
+
+#endif // MODULEPREFETCHER_H
@@ -0,0 +1,229 @@
+// SPDX-FileCopyrightText: 2022 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include "moduleregistry.h"
+#include "moduleprefetcher.h"
+#include "insertplugin.h"
+#include "interface/moduleinterface.h"
+
+#include <QElapsedTimer>
+#include <QPointer>
+#include <QTimer>
+#include <QDebug>
+
+using namespace DCC_NAMESPACE;
+
+// 等待模块预取数据的最长时间，dbus 默认超时为 25s，服务无响应时不能让模块一直不可见
+const int PrefetchTimeout = 3000;
+
+ModuleRegistry::ModuleRegistry(QObject *parent)
+    : QObject(parent)
+    , m_runScheduled(false)
+{
+}
+
+void ModuleRegistry::registerLazy(ModuleInterface *inter)
+{
+    if (!inter)
+        return;
+
+    m_lazyModules.insert(inter);
+}
+
+bool ModuleRegistry::isLazy(ModuleInterface *inter) const
+{
+    return m_lazyModules.contains(inter);
+}
+
+bool ModuleRegistry::isPreInitialized(ModuleInterface *inter) const
+{
+    return m_preInitialized.contains(inter);
+}
+
+void ModuleRegistry::addDependency(const QString &module, const QString &dependsOn)
+{
+    if (module == dependsOn || m_dependencies.contains(module, dependsOn))
+        return;
+
+    m_dependencies.insert(module, dependsOn);
+}
+
+void ModuleRegistry::preInitializeEager(const QList<QPair<ModuleInterface *, QString>> &modules, const QString &m)
+{
+    ModuleInterface *requested = nullptr;
+    for (auto it = modules.cbegin(); it != modules.cend(); ++it) {
+        ModuleInterface *inter = it->first;
+        m_modulesByName.insert(inter->name(), inter);
+        // 子页面翻译只是静态文案，搜索数据解析时需要用到，提前注册
+        inter->addChildPageTrans();
+
+        if (m == inter->name()) {
+            requested = inter;
+            continue;
+        }
+
+        // 预取只发出异步请求，延迟加载的模块也提前发出，首次使用时 preInitialize 直接使用取回的数据
+        startPrefetch(inter);
+
+        if (isLazy(inter)) {
+            qDebug() << QString("defer %1 module initialize until it is used").arg(inter->name());
+            continue;
+        }
+
+        m_scheduled << inter;
+    }
+
+    // 需要立即显示的模块同步初始化，保证随后的 showModulePage 可以直接使用
+    if (requested)
+        ensurePreInitialized(requested, true);
+
+    if (m_scheduled.isEmpty()) {
+        Q_EMIT eagerPreInitializeFinished();
+        return;
+    }
+
+    if (!m_prefetching.isEmpty())
+        QTimer::singleShot(PrefetchTimeout, this, &ModuleRegistry::onPrefetchTimeout);
+
+    scheduleNext();
+}
+
+void ModuleRegistry::ensurePreInitialized(ModuleInterface *inter, bool sync)
+{
+    if (!inter || isPreInitialized(inter))
+        return;
+
+    if (m_inProgress.contains(inter)) {
+        // 依赖成环时在此断开，立即预初始化，保证等待该模块就绪的请求不会一直挂起
+        qWarning() << "module dependency cycle detected at" << inter->name() << ", initialize it without waiting for its dependencies";
+        doPreInitialize(inter, sync);
+        return;
+    }
+
+    m_inProgress.insert(inter);
+    for (const QString &dependsOn : m_dependencies.values(inter->name())) {
+        ensurePreInitialized(m_modulesByName.value(dependsOn), sync);
+    }
+    m_inProgress.remove(inter);
+
+    // 环上的模块可能已在断开处完成预初始化
+    if (!isPreInitialized(inter))
+        doPreInitialize(inter, sync);
+}
+
+void ModuleRegistry::runNextScheduled()
+{
+    m_runScheduled = false;
+
+    // 队列中的模块可能已因被使用或被依赖而提前初始化
+    for (auto it = m_scheduled.begin(); it != m_scheduled.end();) {
+        if (isPreInitialized(*it))
+            it = m_scheduled.erase(it);
+        else
+            ++it;
+    }
+
+    if (m_scheduled.isEmpty()) {
+        Q_EMIT eagerPreInitializeFinished();
+        return;
+    }
+
+    // 按队列顺序取第一个数据已就绪的模块，其余模块的请求仍在后台进行
+    auto it = std::find_if(m_scheduled.begin(), m_scheduled.end(), [this](ModuleInterface *inter) {
+        QSet<ModuleInterface *> visited;
+        return !isPrefetchPending(inter, visited);
+    });
+    // 剩余模块都在等待数据，由预取完成或超时重新调度
+    if (it == m_scheduled.end())
+        return;
+
+    ModuleInterface *inter = *it;
+    m_scheduled.erase(it);
+    ensurePreInitialized(inter);
+    scheduleNext();
+}
+
+void ModuleRegistry::onPrefetchTimeout()
+{
+    if (m_prefetching.isEmpty())
+        return;
+
+    QStringList names;
+    for (ModuleInterface *inter : m_prefetching)
+        names << inter->name();
+    qWarning() << "prefetch of" << names << "not finished in" << PrefetchTimeout << "ms, initialize them without waiting";
+
+    m_prefetching.clear();
+    if (!m_scheduled.isEmpty())
+        scheduleNext();
+}
+
+void ModuleRegistry::doPreInitialize(ModuleInterface *inter, bool sync)
+{
+    m_preInitialized.insert(inter);
+
+    QElapsedTimer et;
+    et.start();
+    inter->preInitialize(sync);
+    qDebug() << QString("initialize %1 module using time: %2ms")
+             .arg(inter->name())
+             .arg(et.elapsed());
+    if (inter->isAvailable()) {
+        // 模块有效时先初始化模块和搜索数据
+        InsertPlugin::instance()->preInitialize(inter->name());
+    }
+
+    Q_EMIT modulePreInitialized(inter);
+}
+
+void ModuleRegistry::startPrefetch(ModuleInterface *inter)
+{
+    ModulePrefetcher *prefetcher = dynamic_cast<ModulePrefetcher *>(inter);
+    if (!prefetcher)
+        return;
+
+    m_prefetching.insert(inter);
+    // 模块可能在 prefetch 中直接调用 done，需先登记再启动
+    QPointer<ModuleRegistry> self(this);
+    prefetcher->prefetch([self, inter] {
+        if (self)
+            self->onPrefetchFinished(inter);
+    });
+}
+
+void ModuleRegistry::onPrefetchFinished(ModuleInterface *inter)
+{
+    // 超时后才返回的数据仍由模块自行使用，不影响调度
+    if (!m_prefetching.remove(inter))
+        return;
+
+    if (!m_scheduled.isEmpty())
+        scheduleNext();
+}
+
+bool ModuleRegistry::isPrefetchPending(ModuleInterface *inter, QSet<ModuleInterface *> &visited) const
+{
+    if (!inter || visited.contains(inter) || isPreInitialized(inter))
+        return false;
+
+    visited.insert(inter);
+    if (m_prefetching.contains(inter))
+        return true;
+
+    for (const QString &dependsOn : m_dependencies.values(inter->name())) {
+        if (isPrefetchPending(m_modulesByName.value(dependsOn), visited))
+            return true;
+    }
+
+    return false;
+}
+
+void ModuleRegistry::scheduleNext()
+{
+    if (m_runScheduled)
+        return;
+
+    m_runScheduled = true;
+    QTimer::singleShot(0, this, &ModuleRegistry::runNextScheduled);
+}
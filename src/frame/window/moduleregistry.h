@@ -0,0 +1,72 @@
+// SPDX-FileCopyrightText: 2022 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#ifndef MODULEREGISTRY_H
+#define MODULEREGISTRY_H
+
+#include "interface/namespace.h"
+
+#include <QObject>
+#include <QSet>
+#include <QMultiHash>
+#include <QStringList>
+
+namespace DCC_NAMESPACE {
+class ModuleInterface;
+
+// ModuleRegistry 负责按需预初始化一级模块
+// 模块对象本身只保存名称、图标等元数据，构造开销很小；真正耗时的是 preInitialize 中创建 worker/model 及其 dbus 代理
+// 注册为延迟加载的模块只在导航、搜索结果或 ShowPage 首次需要时才执行 preInitialize
+// 其余模块按依赖顺序排队，每个事件循环只预初始化一个，窗口和 dbus 服务不必等待全部模块完成
+// 实现了 ModulePrefetcher 的模块在启动时同时发出各自的异步请求，请求返回后才在主线程执行其 preInitialize，
+// 排队时跳过仍在等待数据的模块；超过 PrefetchTimeout 仍未返回的模块不再等待，由 preInitialize 同步获取
+// 未实现该接口的模块，preInitialize 中的同步 dbus 调用仍在主线程上依次执行
+// 依赖成环时在环上断开，每个模块都会完成预初始化并发出 modulePreInitialized
+class ModuleRegistry : public QObject
+{
+    Q_OBJECT
+public:
+    explicit ModuleRegistry(QObject *parent = nullptr);
+
+    // 将模块登记为延迟加载，未登记的模块(如插件)仍在启动时预初始化
+    void registerLazy(ModuleInterface *inter);
+    bool isLazy(ModuleInterface *inter) const;
+    bool isPreInitialized(ModuleInterface *inter) const;
+    // 声明模块 module 必须在 dependsOn 之后预初始化
+    void addDependency(const QString &module, const QString &dependsOn);
+
+    // 启动阶段调用：立即预初始化需要显示的模块 m，其余非延迟模块排队依次预初始化
+    void preInitializeEager(const QList<QPair<ModuleInterface *, QString>> &modules, const QString &m = QString());
+    // 确保模块已完成 preInitialize，首次调用时才会真正创建模块的 worker/model
+    void ensurePreInitialized(ModuleInterface *inter, bool sync = false);
+
+Q_SIGNALS:
+    void modulePreInitialized(ModuleInterface *inter);
+    void eagerPreInitializeFinished();
+
+private Q_SLOTS:
+    void runNextScheduled();
+    void onPrefetchTimeout();
+
+private:
+    void doPreInitialize(ModuleInterface *inter, bool sync);
+    void startPrefetch(ModuleInterface *inter);
+    void onPrefetchFinished(ModuleInterface *inter);
+    // 模块或其依赖的模块是否仍在等待预取的数据
+    bool isPrefetchPending(ModuleInterface *inter, QSet<ModuleInterface *> &visited) const;
+    void scheduleNext();
+
+private:
+    QSet<ModuleInterface *> m_lazyModules;
+    QSet<ModuleInterface *> m_preInitialized;
+    QSet<ModuleInterface *> m_inProgress;
+    QMultiHash<QString, QString> m_dependencies;         // 模块名 -> 依赖的模块名
+    QHash<QString, ModuleInterface *> m_modulesByName;
+    QList<ModuleInterface *> m_scheduled;
+    QSet<ModuleInterface *> m_prefetching;
+    bool m_runScheduled;
+};
+}
+
+#endif // MODULEREGISTRY_H
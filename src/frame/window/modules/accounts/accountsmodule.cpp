@@ -34,6 +34,14 @@ AccountsModule::AccountsModule(FrameProxyInterface *frame, QObject *parent)
     m_pMainWindow = dynamic_cast<MainWindow *>(m_frameProxy);
 }
 
+void AccountsModule::prefetch(std::function<void()> done)
+{
+    AccountsWorker::prefetch(this, [this, done](const AccountsPrefetch &data) {
+        m_prefetch = std::make_shared<AccountsPrefetch>(data);
+        done();
+    });
+}
+
 void AccountsModule::preInitialize(bool sync, dccV20::FrameProxyInterface::PushType)
 {
     Q_UNUSED(sync)
@@ -43,7 +51,9 @@ void AccountsModule::preInitialize(bool sync, dccV20::FrameProxyInterface::PushT
     }
 
     m_userModel = new UserModel(this);
-    m_accountsWorker = new AccountsWorker(m_userModel);
+    // 预取未完成时由 worker 同步获取
+    m_accountsWorker = new AccountsWorker(m_userModel, nullptr, m_prefetch ? *m_prefetch : AccountsPrefetch());
+    m_prefetch.reset();
 
     m_accountsWorker->moveToThread(qApp->thread());
     m_userModel->moveToThread(qApp->thread());
@@ -6,13 +6,17 @@
 
 #include "interface/moduleinterface.h"
 #include "../../mainwindow.h"
+#include "../../moduleprefetcher.h"
 
 #include <com_deepin_daemon_accounts.h>
 
+#include <memory>
+
 namespace dcc {
 namespace accounts {
 class User;
 class AccountsWorker;
+struct AccountsPrefetch;
 class UserModel;
 }
 }
@@ -20,7 +24,7 @@ class UserModel;
 namespace DCC_NAMESPACE {
 namespace accounts {
 class AccountsWidget;
-class AccountsModule : public QObject, public ModuleInterface
+class AccountsModule : public QObject, public ModuleInterface, public ModulePrefetcher
 {
     Q_OBJECT
 
@@ -37,6 +41,7 @@ class AccountsModule : public QObject, public ModuleInterface
 public:
     explicit AccountsModule(FrameProxyInterface *frame, QObject *parent = nullptr);
 
+    void prefetch(std::function<void()> done) override;
     virtual void preInitialize(bool sync = false, FrameProxyInterface::PushType = FrameProxyInterface::PushType::Normal) override;
     void initialize() override;
     void reset() override;
@@ -67,6 +72,7 @@ private:
 private:
     dcc::accounts::UserModel *m_userModel{nullptr};
     dcc::accounts::AccountsWorker *m_accountsWorker{nullptr};
+    std::shared_ptr<dcc::accounts::AccountsPrefetch> m_prefetch;
     AccountsWidget *m_accountsWidget = nullptr;
     MainWindow *m_pMainWindow = nullptr;
     bool m_isCreatePage;
@@ -26,10 +26,20 @@ BluetoothModule::BluetoothModule(FrameProxyInterface *frame, QObject *parent)
 
 }
 
+void BluetoothModule::prefetch(std::function<void()> done)
+{
+    BluetoothWorker::prefetch(this, [this, done](const BluetoothPrefetch &data) {
+        m_prefetch = std::make_shared<BluetoothPrefetch>(data);
+        done();
+    });
+}
+
 void BluetoothModule::preInitialize(bool sync , FrameProxyInterface::PushType pushtype)
 {
     Q_UNUSED(pushtype);
-    m_bluetoothWorker = &BluetoothWorker::Instance(sync);
+    // 预取未完成时由 worker 同步获取
+    m_bluetoothWorker = &BluetoothWorker::Instance(sync, m_prefetch ? *m_prefetch : BluetoothPrefetch());
+    m_prefetch.reset();
     m_bluetoothModel = m_bluetoothWorker->model();
     m_bluetoothModel->moveToThread(qApp->thread());
     m_bluetoothWorker->moveToThread(qApp->thread());
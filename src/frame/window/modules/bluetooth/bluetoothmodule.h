@@ -6,16 +6,20 @@
 
 #include "interface/namespace.h"
 #include "interface/moduleinterface.h"
+#include "window/moduleprefetcher.h"
 
 #include <QMap>
 #include <QObject>
 
+#include <memory>
+
 class QDBusObjectPath;
 
 namespace dcc {
 namespace bluetooth {
 class BluetoothModel;
 class BluetoothWorker;
+struct BluetoothPrefetch;
 class Device;
 class Adapter;
 class PinCodeDialog;
@@ -25,11 +29,12 @@ class PinCodeDialog;
 namespace DCC_NAMESPACE {
 namespace bluetooth {
 class BluetoothWidget;
-class BluetoothModule : public QObject, public ModuleInterface
+class BluetoothModule : public QObject, public ModuleInterface, public ModulePrefetcher
 {
     Q_OBJECT
 public:
     explicit BluetoothModule(FrameProxyInterface *frame, QObject *parent = nullptr);
+    void prefetch(std::function<void()> done) override;
     void preInitialize(bool sync = false , FrameProxyInterface::PushType = FrameProxyInterface::PushType::Normal) override;
     void initialize() override;
     void reset() override;
@@ -53,6 +58,7 @@ private:
     BluetoothWidget *m_bluetoothWidget;
     dcc::bluetooth::BluetoothModel *m_bluetoothModel;
     dcc::bluetooth::BluetoothWorker *m_bluetoothWorker;
+    std::shared_ptr<dcc::bluetooth::BluetoothPrefetch> m_prefetch;
     QMap<QDBusObjectPath, dcc::bluetooth::PinCodeDialog *> m_dialogs;
 };
 }
@@ -7,7 +7,7 @@
 #include <QPainter>
 #include <QPainterPath>
 #include <QIcon>
-#include <QTimer>
+#include <QPixmapCache>
 
 using namespace DCC_NAMESPACE;
 using namespace DCC_NAMESPACE::datetime;
@@ -17,11 +17,8 @@ Clock::Clock(QWidget *parent)
     , m_drawTicks(true)
     , m_autoNightMode(true)
     , n_bIsUseBlackPlat(true)
+    , m_isBlack(false)
 {
-    m_hour = getPixmap(":/datetime/icons/dcc_noun_hour.svg", pointSize);
-    m_min = getPixmap(":/datetime/icons/dcc_noun_minute.svg", pointSize);
-    m_sec = getPixmap(":/datetime/icons/dcc_noun_second.svg", pointSize);
-
     /*以下三行为默认程序模块服务，由于每个cpp只能有一种翻译，故将注释分配到其他地方*/
     //~ contents_path /defapp/Mail/Add Application
     //~ child_page Mail
@@ -45,59 +42,86 @@ QPixmap Clock::getPixmap(const QString &name, const QSize size)
     return pixmap;
 }
 
-void Clock::paintEvent(QPaintEvent *event)
+QPixmap Clock::cachedPixmap(const QString &name, const QSize size)
 {
-    Q_UNUSED(event)
+    // 所有时钟共用栅格化后的 svg，按尺寸和缩放比区分
+    const QString &key = QString("dcc-clock|%1|%2x%3|%4").arg(name).arg(size.width()).arg(size.height()).arg(devicePixelRatioF());
+    QPixmap pixmap;
+    if (!QPixmapCache::find(key, &pixmap)) {
+        pixmap = getPixmap(name, size);
+        QPixmapCache::insert(key, pixmap);
+    }
+    return pixmap;
+}
 
-    QDateTime datetime(QDateTime::currentDateTime());
-    const QTime time(datetime.time());
-    QPainter painter(this);
-    painter.setRenderHints(QPainter::HighQualityAntialiasing | QPainter::SmoothPixmapTransform);
+const QPixmap &Clock::face(const QTime &time)
+{
+    const bool nightMode = !(time.hour() >= 6  && time.hour() < 18);
+    int nHour = (time.hour() >= 12) ? (time.hour() - 12) : time.hour();
+    int nStartAngle = 90;//The image from 0 start , but the clock need from -90 start
 
-    do {
-        const bool nightMode = !(time.hour() >= 6  && time.hour() < 18);
-        if (nightMode == m_isBlack && !m_plat.isNull())
-            break;
-        if (nightMode) {
-            m_plat = getPixmap(":/datetime/icons/dcc_clock_black.svg", clockSize);
-            m_isBlack = true;
-        } else {
-            m_plat = getPixmap(":/datetime/icons/dcc_clock_white.svg", clockSize);
-            m_isBlack = false;
-        }
-    } while(false);
+    const qreal hourAngle = qreal(nHour * 30 + time.minute() * 30 / 60 + time.second() * 30 / 60 / 60 - nStartAngle);
+    const qreal minuteAngle = qreal(time.minute() * 6 + time.second() * 6 / 60 - nStartAngle);
+    const qreal ratio = devicePixelRatioF();
 
-    // draw plate
-    painter.save();
-    painter.translate(width() / 2.0, height() / 2.0);
-    painter.drawPixmap(QPointF(-clockSize.width() / 2.0, -clockSize.height() / 2.0), m_plat);
-    painter.restore();
+    const QString &key = QString("%1|%2|%3|%4").arg(nightMode).arg(hourAngle).arg(minuteAngle).arg(ratio);
+    if (key == m_faceKey && !m_face.isNull())
+        return m_face;
 
-    int nHour = (time.hour() >= 12) ? (time.hour() - 12) : time.hour();
-    int nStartAngle = 90;//The image from 0 start , but the clock need from -90 start
+    m_isBlack = nightMode;
+    m_faceKey = key;
+    m_face = QPixmap(clockSize * ratio);
+    m_face.setDevicePixelRatio(ratio);
+    m_face.fill(Qt::transparent);
+
+    QPainter painter(&m_face);
+    painter.setRenderHints(QPainter::HighQualityAntialiasing | QPainter::SmoothPixmapTransform);
+
+    // draw plate
+    painter.drawPixmap(QPointF(0, 0), cachedPixmap(nightMode ? ":/datetime/icons/dcc_clock_black.svg"
+                                                             : ":/datetime/icons/dcc_clock_white.svg", clockSize));
 
     // draw hour hand
-    const qreal hourAngle = qreal(nHour * 30 + time.minute() * 30 / 60 + time.second() * 30 / 60 / 60 - nStartAngle);
     painter.save();
-    painter.translate(width() / 2.0, height() / 2.0);
+    painter.translate(clockSize.width() / 2.0, clockSize.height() / 2.0);
     painter.rotate(hourAngle);
-    painter.drawPixmap(QPointF(-pointSize.width() / 2.0, -pointSize.height() / 2.0), m_hour);
+    painter.drawPixmap(QPointF(-pointSize.width() / 2.0, -pointSize.height() / 2.0), cachedPixmap(":/datetime/icons/dcc_noun_hour.svg", pointSize));
     painter.restore();
 
     // draw minute hand
-    const qreal minuteAngle = qreal(time.minute() * 6 + time.second() * 6 / 60 - nStartAngle);
     painter.save();
-    painter.translate(width() / 2.0, height() / 2.0);
+    painter.translate(clockSize.width() / 2.0, clockSize.height() / 2.0);
     painter.rotate(minuteAngle);
-    painter.drawPixmap(QPointF(-pointSize.width() / 2.0, -pointSize.height() / 2.0), m_min);
+    painter.drawPixmap(QPointF(-pointSize.width() / 2.0, -pointSize.height() / 2.0), cachedPixmap(":/datetime/icons/dcc_noun_minute.svg", pointSize));
+    painter.restore();
+
+    painter.end();
+    return m_face;
+}
+
+void Clock::paintEvent(QPaintEvent *event)
+{
+    Q_UNUSED(event)
+
+    QDateTime datetime(QDateTime::currentDateTime());
+    const QTime time(datetime.time());
+    QPainter painter(this);
+    painter.setRenderHints(QPainter::HighQualityAntialiasing | QPainter::SmoothPixmapTransform);
+
+    // draw plate, hour hand and minute hand
+    painter.save();
+    painter.translate(width() / 2.0, height() / 2.0);
+    painter.drawPixmap(QPointF(-clockSize.width() / 2.0, -clockSize.height() / 2.0), face(time));
     painter.restore();
 
+    int nStartAngle = 90;//The image from 0 start , but the clock need from -90 start
+
     // draw second hand
     const qreal secondAngle = qreal(time.second() * 6 - nStartAngle);
     painter.save();
     painter.translate(width() / 2.0, height() / 2.0);
     painter.rotate(secondAngle);
-    painter.drawPixmap(QPointF(-pointSize.width() / 2.0, -pointSize.height() / 2.0), m_sec);
+    painter.drawPixmap(QPointF(-pointSize.width() / 2.0, -pointSize.height() / 2.0), cachedPixmap(":/datetime/icons/dcc_noun_second.svg", pointSize));
     painter.restore();
 
     painter.end();
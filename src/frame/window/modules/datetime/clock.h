@@ -33,16 +33,19 @@ public:
 protected:
     void paintEvent(QPaintEvent *event);
 
+private:
+    QPixmap cachedPixmap(const QString &name, const QSize size);
+    const QPixmap &face(const QTime &time);
+
 private:
     bool m_drawTicks;
     bool m_autoNightMode;
     bool n_bIsUseBlackPlat;
     bool m_isBlack;
     ZoneInfo m_timeZone;
-    QPixmap m_plat;
-    QPixmap m_hour;
-    QPixmap m_min;
-    QPixmap m_sec;
+    // 表盘和时针、分针合成的图像，只在分针转动或表盘切换时重绘
+    QPixmap m_face;
+    QString m_faceKey;
 };
 }// namespace datetime
 }// namespace DCC_NAMESPACE
@@ -4,12 +4,12 @@
 
 #include "clock.h"
 #include "clockitem.h"
+#include "modules/datetime/clockticker.h"
 #include "widgets/labels/normallabel.h"
 
 #include <DTipLabel>
 
 #include <QVBoxLayout>
-#include <QTimer>
 #include <QFontDatabase>
 #include <QDebug>
 
@@ -27,13 +27,13 @@ ClockItem::ClockItem(QWidget *parent, bool isDisplay)
     , m_timeType(nullptr)
     , m_bIs24HourType(false)
     , m_bIsEnglishType(false)
-    , m_timedateInter(new Timedate("com.deepin.daemon.Timedate", "/com/deepin/daemon/Timedate", QDBusConnection::sessionBus(), this))
-    , m_appearanceInter(new Appearance("com.deepin.daemon.Appearance", "/com/deepin/daemon/Appearance", QDBusConnection::sessionBus(), this))
+    , m_timedateInter(dcc::DBusProxyRegistry::get<Timedate>("com.deepin.daemon.Timedate", "/com/deepin/daemon/Timedate", QDBusConnection::sessionBus()))
+    , m_appearanceInter(dcc::DBusProxyRegistry::get<Appearance>("com.deepin.daemon.Appearance", "/com/deepin/daemon/Appearance", QDBusConnection::sessionBus()))
     , m_weekdayFormat("dddd")
     , m_shortDateFormat("yyyy-MM-dd")
     , m_longTimeFormat("HH:mm:ss")
     , m_timeLayout(new QHBoxLayout)
-    , m_labelTimeFontSize(m_appearanceInter->fontSize())
+    , m_labelTimeFontSize(dcc::DBusProxyRegistry::syncRead(m_appearanceInter.get(), &Appearance::fontSize))
 {
     m_clock->setAccessibleName("ClockItem_clock");
     m_clock->setMinimumSize(210, 210);
@@ -102,15 +102,11 @@ ClockItem::ClockItem(QWidget *parent, bool isDisplay)
 
     setLayout(layout);
 
-    QTimer *timer = new QTimer(this);
-    timer->setSingleShot(false);
-    connect(timer, &QTimer::timeout, this, &ClockItem::updateDateTime, Qt::DirectConnection);
+    connect(dcc::datetime::ClockTicker::instance(), &dcc::datetime::ClockTicker::secondChanged, this, &ClockItem::updateDateTime);
 
-    timer->start(1000);
-
-    setWeekdayFormatType(m_timedateInter->weekdayFormat());
-    setShortDateFormat(m_timedateInter->shortDateFormat());
-    setLongTimeFormat(m_timedateInter->longTimeFormat());
+    setWeekdayFormatType(dcc::DBusProxyRegistry::syncRead(m_timedateInter.get(), &Timedate::weekdayFormat));
+    setShortDateFormat(dcc::DBusProxyRegistry::syncRead(m_timedateInter.get(), &Timedate::shortDateFormat));
+    setLongTimeFormat(dcc::DBusProxyRegistry::syncRead(m_timedateInter.get(), &Timedate::longTimeFormat));
 
     connect(m_timedateInter, &Timedate::WeekdayFormatChanged, this, &ClockItem::setWeekdayFormatType);
     connect(m_timedateInter, &Timedate::ShortDateFormatChanged, this, &ClockItem::setShortDateFormat);
@@ -6,6 +6,7 @@
 
 #include "interface/namespace.h"
 #include "widgets/settingsitem.h"
+#include "modules/dbusproxyregistry.h"
 
 #include <com_deepin_daemon_timedate.h>
 #include <com_deepin_daemon_appearance.h>
@@ -65,8 +66,8 @@ private:
     bool m_bIs24HourType;
     bool m_bIsEnglishType;
     bool m_weekStartMonType;
-    Timedate *m_timedateInter;
-    Appearance *m_appearanceInter;
+    dcc::SharedDBusProxy<Timedate> m_timedateInter;
+    dcc::SharedDBusProxy<Appearance> m_appearanceInter;
     QString m_weekdayFormat;
     QString m_shortDateFormat;
     QString m_longTimeFormat;
@@ -5,6 +5,7 @@
 #include "timezonecontentlist.h"
 #include "widgets/settingsgroup.h"
 #include "widgets/settingsitem.h"
+#include "modules/datetime/clockticker.h"
 #include "modules/datetime/timezoneitem.h"
 #include "modules/datetime/timezone_dialog/timezone.h"
 #include "modules/datetime/timezone_dialog/timezonechooser.h"
@@ -31,6 +32,9 @@ TimezoneContentList::TimezoneContentList(QWidget *parent)
     mainWidget->setLayout(m_centralLayout);
     layout()->setMargin(0);
     setContent(mainWidget);
+
+    // 世界时钟只显示时针和分针，每分钟刷新一次
+    connect(ClockTicker::instance(), &ClockTicker::minuteChanged, this, &TimezoneContentList::updateTimezoneItems);
 }
 
 TimezoneContentList::~TimezoneContentList()
@@ -17,6 +17,7 @@
 #include "widgets/timeoutdialog.h"
 #include "modules/display/displaymodel.h"
 #include "modules/display/displayworker.h"
+#include "modules/display/displayconfigtransaction.h"
 
 #include <QApplication>
 #include <QDesktopWidget>
@@ -359,7 +360,6 @@ void DisplayModule::showMultiScreenWidget()
 
 void DisplayModule::onRequestSetResolution(Monitor *monitor, const int mode)
 {
-    Resolution lastRes = monitor->currentMode();
     Resolution firstRes;
 
     for (auto res : monitor->modeList()) {
@@ -369,47 +369,26 @@ void DisplayModule::onRequestSetResolution(Monitor *monitor, const int mode)
         }
     }
 
-    auto tfunc = [this](Monitor *tmon, Resolution tmode) {
-        if (m_displayModel->displayMode() == MERGE_MODE) {
-            for (auto monitor : m_displayModel->monitorList()) {
-                bool bFind = false;
-                for (auto res : monitor->modeList()) {
-                    if (res == tmode) {
-                        m_displayWorker->setMonitorResolution(monitor, res.id());
-                        bFind = true;
-                        break;
-                    }
-                }
-                if (!bFind) {
-                    m_displayWorker->setMonitorResolutionBySize(monitor, tmode.width(), tmode.height());
-                }
+    DisplayConfigTransaction *transaction = beginConfigTransaction();
+    if (m_displayModel->displayMode() == MERGE_MODE) {
+        for (auto m : m_displayModel->monitorList()) {
+            if (m_displayModel->modeTable(m).contains(firstRes)) {
+                transaction->setResolution(m, static_cast<int>(firstRes.id()));
+            } else {
+                transaction->setResolutionBySize(m, firstRes.width(), firstRes.height());
             }
-        } else {
-            m_displayWorker->setMonitorResolution(tmon, tmode.id());
         }
-
-        // 扩展模式调整分辨率时会再次调整显示屏位置，此时会调用两次applyChanges接口，
-        // 修改分辨率调用applyChanges后任务栏会响应分辨率改变信号，然后调整大小，造成部分界面显示到第二个屏幕
-        // 只有一个屏幕时displayMode可能是EXTEND_MODE，同时需要判断显示数量
-        if (m_displayModel->displayMode() != EXTEND_MODE || m_displayModel->monitorList().size() < 2)
-            m_displayWorker->applyChanges();
-    };
-
-    tfunc(monitor, firstRes);
-    QString lastFillMode = "";
-    if (m_displayModel->primaryMonitor() != nullptr) {
-        lastFillMode = m_displayModel->primaryMonitor()->currentFillMode();
+    } else {
+        transaction->setResolution(monitor, static_cast<int>(firstRes.id()));
     }
-    //此处处理调用applyChanges的200ms延时, TimeoutDialog提前弹出的问题
-    QTimer::singleShot(300, monitor, [this, tfunc, monitor, lastRes,lastFillMode]{
-        if (showTimeoutDialog(monitor) == QDialog::Accepted) {
-            m_displayWorker->saveChanges();
-        } else {
-            tfunc(monitor, lastRes);
-            onSetFillMode(lastFillMode);
-        }
-    });
 
+    // 扩展模式调整分辨率时会再次调整显示屏位置，此时会调用两次applyChanges接口，
+    // 修改分辨率调用applyChanges后任务栏会响应分辨率改变信号，然后调整大小，造成部分界面显示到第二个屏幕
+    // 此时由位置调整触发 applyChanges，事务等待其完成后再弹出确认框
+    // 只有一个屏幕时displayMode可能是EXTEND_MODE，同时需要判断显示数量
+    const bool applyChanges = m_displayModel->displayMode() != EXTEND_MODE || m_displayModel->monitorList().size() < 2;
+    awaitConfirmation(transaction, monitor);
+    transaction->commit(applyChanges ? DisplayConfigTransaction::ApplyNow : DisplayConfigTransaction::WaitForApply);
 }
 
 void DisplayModule::onSetFillMode(QString currFullMode)
@@ -433,43 +412,51 @@ void DisplayModule::onSetFillMode(QString currFullMode)
 
 void DisplayModule::onRequestSetFillMode(dcc::display::Monitor *monitor, const QString fillMode)
 {
-    auto lastFillMode = monitor->currentFillMode();
+    DisplayConfigTransaction *transaction = beginConfigTransaction();
     if (m_displayModel->displayMode() == MERGE_MODE) {
         for (auto m : m_displayModel->monitorList())
-            m_displayWorker->setCurrentFillMode(m, fillMode);
+            transaction->setFillMode(m, fillMode);
     } else {
-        m_displayWorker->setCurrentFillMode(monitor, fillMode);
+        transaction->setFillMode(monitor, fillMode);
     }
+
     //桌面显示增加15秒倒计时功能
-    QTimer::singleShot(300, monitor, [this, monitor, lastFillMode]{
-        if (showTimeoutDialog(monitor, true) != QDialog::Accepted) {
-            if (m_displayModel->displayMode() == MERGE_MODE) {
-                for (auto m : m_displayModel->monitorList())
-                    m_displayWorker->setCurrentFillMode(m, lastFillMode);
-            }
-            else {
-               m_displayWorker->setCurrentFillMode(monitor, lastFillMode);
-            }
-        }
-    });
+    awaitConfirmation(transaction, monitor, true);
+    transaction->commit(DisplayConfigTransaction::NoApply);
 }
 
 void DisplayModule::onRequestSetRotate(Monitor *monitor, const int rotate)
 {
-    auto lastRotate = monitor->rotate();
-    m_displayWorker->setMonitorRotate(monitor, rotate);
-    m_displayWorker->applyChanges();
-
-    //此处处理调用applyChanges的200ms延时, TimeoutDialog提前弹出的问题
-    QTimer::singleShot(300, monitor, [this, monitor, lastRotate]{
-        if (showTimeoutDialog(monitor) == QDialog::Accepted) {
-            m_displayWorker->saveChanges();
+    DisplayConfigTransaction *transaction = beginConfigTransaction();
+    transaction->setRotate(monitor, static_cast<quint16>(rotate));
+    awaitConfirmation(transaction, monitor);
+    transaction->commit(DisplayConfigTransaction::ApplyNow);
+}
+
+DisplayConfigTransaction *DisplayModule::beginConfigTransaction()
+{
+    // 上一次的变更还未生效时以新的变更为准，新的事务以当前状态为还原点
+    if (m_configTransaction)
+        m_configTransaction->deleteLater();
+
+    m_configTransaction = new DisplayConfigTransaction(m_displayModel, m_displayWorker, this);
+    connect(m_configTransaction, &DisplayConfigTransaction::finished, m_configTransaction, &DisplayConfigTransaction::deleteLater);
+    return m_configTransaction;
+}
+
+void DisplayModule::awaitConfirmation(DisplayConfigTransaction *transaction, Monitor *monitor, const bool isFillMode)
+{
+    // 变更生效后再弹出倒计时对话框，拒绝或超时按变更前的状态还原
+    connect(transaction, &DisplayConfigTransaction::awaitingConfirmation, monitor, [this, transaction, monitor, isFillMode] {
+        QPointer<DisplayConfigTransaction> guard(transaction);
+        const int result = showTimeoutDialog(monitor, isFillMode);
+        if (!guard)
+            return;
+
+        if (result == QDialog::Accepted) {
+            transaction->confirm();
         } else {
-            // 若是重力感应 调整后不对数据进行保存
-            if (monitor->currentRotateMode() != dcc::display::Monitor::RotateMode::Gravity) {
-                m_displayWorker->setMonitorRotate(monitor, lastRotate);
-                m_displayWorker->applyChanges();
-            }
+            transaction->revert();
         }
     });
 }
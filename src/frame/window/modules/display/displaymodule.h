@@ -10,6 +10,8 @@
 #include "../../mainwindow.h"
 #include "modules/display/recognizewidget.h"
 
+#include <QPointer>
+
 using namespace dcc::display;
 
 class Resolution;
@@ -19,6 +21,7 @@ namespace display {
 class DisplayModel;
 class Monitor;
 class DisplayWorker;
+class DisplayConfigTransaction;
 } // namespace display
 } // namespace dcc
 
@@ -60,12 +63,17 @@ private Q_SLOTS:
     void initSearchData() override;
     void showDisplayRecognize();
 
+private:
+    dcc::display::DisplayConfigTransaction *beginConfigTransaction();
+    void awaitConfirmation(dcc::display::DisplayConfigTransaction *transaction, dcc::display::Monitor *monitor, const bool isFillMode = false);
+
 private:
     dcc::display::DisplayModel *m_displayModel;
     dcc::display::DisplayWorker *m_displayWorker;
     DisplayWidget *m_displayWidget;
     MainWindow *m_pMainWindow;
     QMap<QString, RecognizeWidget *> m_recognizeWidget;
+    QPointer<dcc::display::DisplayConfigTransaction> m_configTransaction;
 };
 
 } // namespace display
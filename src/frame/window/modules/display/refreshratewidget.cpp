@@ -114,24 +114,12 @@ void RefreshRateWidget::initRefreshRate()
         m_refreshItemModel->clear();
     }
 
-    auto modeList = m_monitor->modeList();
+    // 只列出当前分辨率下的模式，复制模式下只保留所有屏幕共有的刷新率
+    const QList<Resolution> modeList = m_model->modeTable(m_monitor).modes(m_monitor->currentMode());
     bool first = true;
     for (auto mode : modeList) {
-        if (!Monitor::isSameResolution(mode, m_monitor->currentMode()))
+        if (m_model->displayMode() == MERGE_MODE && !m_model->isCommonMode(mode)) {
             continue;
-
-        if (m_model->displayMode() == MERGE_MODE) {
-            bool isComm = true;
-            for (auto monitor : m_model->monitorList()) {
-                if (!monitor->hasResolutionAndRate(mode)) {
-                    isComm = false;
-                    break;
-                }
-            }
-
-            if (!isComm) {
-                continue;
-            }
         }
 
         auto rate = mode.rate();
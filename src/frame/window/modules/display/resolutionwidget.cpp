@@ -242,7 +242,7 @@ void ResolutionWidget::OnCurrentModeChanged(const Resolution &mode)
     }
 
     // 如果当前设置的分辨率不在列表里面，将分辨率选择框置空
-    if (!m_monitor->modeList().contains(mode)) {
+    if (!m_model->modeTable(m_monitor).contains(mode)) {
         m_resolutionCombox->setCurrentIndex(-1);
     }
 }
@@ -407,31 +407,16 @@ void ResolutionWidget::initResolution()
         m_resoItemModel->clear();
     }
 
-    auto modeList = m_monitor->modeList();
+    // 模式列表已按分辨率去重，复制模式下只保留所有屏幕共有的分辨率
+    const MonitorModeTable &modeTable = m_model->modeTable(m_monitor);
     auto curMode = m_monitor->currentMode();
 
-    Resolution preMode;
     if (qgetenv("WAYLAND_DISPLAY").isEmpty() ) {
-        for (auto mode : modeList) {
-            if (Monitor::isSameResolution(preMode, mode)) {
+        for (auto mode : modeTable.resolutions()) {
+            if (m_model->displayMode() == MERGE_MODE && !m_model->isCommonResolution(mode)) {
                 continue;
             }
 
-            preMode = mode;
-            if (m_model->displayMode() == MERGE_MODE) {
-                bool isComm = true;
-                for (auto monitor : m_model->monitorList()) {
-                    if (!monitor->hasResolution(mode)) {
-                        isComm = false;
-                        break;
-                    }
-                }
-
-                if (!isComm) {
-                    continue;
-                }
-            }
-
             auto *item = new DStandardItem;
             item->setData(QVariant(mode.id()), IdRole);
             item->setData(QVariant(mode.rate()), RateRole);
@@ -453,26 +438,11 @@ void ResolutionWidget::initResolution()
         }
     } else {
         bool first = true;
-        for (auto mode : modeList) {
-            if (Monitor::isSameResolution(preMode, mode)) {
+        for (auto mode : modeTable.resolutions()) {
+            if (m_model->displayMode() == MERGE_MODE && !m_model->isCommonResolution(mode)) {
                 continue;
             }
 
-            preMode = mode;
-            if (m_model->displayMode() == MERGE_MODE) {
-                bool isComm = true;
-                for (auto monitor : m_model->monitorList()) {
-                    if (!monitor->hasResolution(mode)) {
-                        isComm = false;
-                        break;
-                    }
-                }
-
-                if (!isComm) {
-                    continue;
-                }
-            }
-
             auto *item = new DStandardItem;
             item->setData(QVariant(mode.id()), IdRole);
             item->setData(QVariant(mode.rate()), RateRole);
@@ -496,7 +466,7 @@ void ResolutionWidget::initResolution()
     }
 
     // 如果当前设置的分辨率不在列表里面，将分辨率选择框置空
-    if (!modeList.contains(curMode)) {
+    if (!modeTable.contains(curMode)) {
         m_resolutionCombox->setCurrentIndex(-1);
     }
 
@@ -528,12 +498,7 @@ void ResolutionWidget::initResolution()
             return;
         }
 
-        for (auto mode : m_monitor->modeList()) {
-            if (mode.width() == w && mode.height() == h) {
-                Q_EMIT requestSetResolution(m_monitor, mode.id());
-                return;
-            }
-        }
-        Q_EMIT requestSetResolution(m_monitor, r);
+        const QList<Resolution> modes = m_model->modeTable(m_monitor).modes(w, h);
+        Q_EMIT requestSetResolution(m_monitor, modes.isEmpty() ? r : modes.first().id());
     });
 }
@@ -37,7 +37,8 @@ ShortCutSettingWidget::ShortCutSettingWidget(ShortcutModel *model, QWidget *pare
 
     setAccessibleName("ShortCutSettingWidget");
     m_searchDelayTimer = new QTimer(this);
-    m_searchDelayTimer->setInterval(300);
+    // 搜索在本地完成，只合并同一轮事件循环中的输入
+    m_searchDelayTimer->setInterval(0);
     m_searchDelayTimer->setSingleShot(true);
 
     m_searchText = QString();
@@ -171,12 +172,19 @@ ShortCutSettingWidget::ShortCutSettingWidget(ShortcutModel *model, QWidget *pare
     setWindowTitle(tr("Shortcut"));
 
     connect(m_model, &ShortcutModel::addCustomInfo, this, &ShortCutSettingWidget::onCustomAdded);
-    //每次页面点击时会通过m_work->refreshShortcut()时,model会发出listChanged信号，对界面进行初始化
+    //每次页面点击时会通过m_work->refreshShortcut()刷新快捷键，分类内容有变化时model会发出listChanged信号，对界面进行更新
     connect(m_model, &ShortcutModel::listChanged, this, &ShortCutSettingWidget::addShortcut);
     connect(m_model, &ShortcutModel::shortcutChanged, this, &ShortCutSettingWidget::onShortcutChanged);
     connect(m_model, &ShortcutModel::keyEvent, this, &ShortCutSettingWidget::onKeyEvent);
     connect(m_model, &ShortcutModel::searchFinished, this, &ShortCutSettingWidget::onSearchStringFinish);
 
+    // 模型只在分类内容变化时发出 listChanged，先用已加载的数据初始化界面
+    addShortcut(m_model->systemInfo(), ShortcutModel::System);
+    addShortcut(m_model->windowInfo(), ShortcutModel::Window);
+    addShortcut(m_model->workspaceInfo(), ShortcutModel::Workspace);
+    addShortcut(m_model->assistiveToolsInfo(), ShortcutModel::AssistiveTools);
+    addShortcut(m_model->customInfo(), ShortcutModel::Custom);
+
     QTimer::singleShot(10, this, [=] {
         widget->show();
         m_searchInput->show();
@@ -521,7 +529,7 @@ void ShortCutSettingWidget::onKeyEvent(bool press, const QString &shortcut)
                 current->item->setShortcut(current->accels);
             } else {
                 // save
-                current->accels = shortcut;
+                m_model->setAccels(current, shortcut);
                 Q_EMIT requestSaveShortcut(current);
             }
         }
@@ -32,8 +32,10 @@ NotificationModule::NotificationModule(dccV20::FrameProxyInterface *frameProxy,
 
 NotificationModule::~NotificationModule()
 {
-    m_worker->deleteLater();
-    m_model->deleteLater();
+    if (m_worker)
+        m_worker->deleteLater();
+    if (m_model)
+        m_model->deleteLater();
 }
 
 // 控制中心启动时会被调用
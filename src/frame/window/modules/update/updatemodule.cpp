@@ -16,6 +16,8 @@
 #include <QVBoxLayout>
 #include <QGSettings>
 
+#include <memory>
+
 DCORE_USE_NAMESPACE
 
 using namespace dcc;
@@ -42,17 +44,32 @@ UpdateModule::~UpdateModule()
     }
 }
 
-void UpdateModule::preInitialize(bool sync, FrameProxyInterface::PushType pushtype)
+static bool isUpdateDisabled()
 {
-    if (!DSysInfo::isDeepin() || DSysInfo::uosEditionType() == DSysInfo::UosEuler) {
-        qInfo() << "module: " << displayName() << " is disable now!";
-        setAvailable(false);
+    return !DSysInfo::isDeepin() || DSysInfo::uosEditionType() == DSysInfo::UosEuler;
+}
+
+void UpdateModule::prefetch(std::function<void()> done)
+{
+    if (isUpdateDisabled()) {
+        done();
         return;
     }
 
-    Q_UNUSED(sync);
-    Q_UNUSED(pushtype);
+    // 提前启动工作线程，lastore 等服务的同步读取在工作线程中进行，activate 完成后再在主线程预初始化
+    createWorker();
+    auto connection = std::make_shared<QMetaObject::Connection>();
+    *connection = connect(m_work.get(), &UpdateWorker::activated, this, [connection, done] {
+        QObject::disconnect(*connection);
+        done();
+    });
+
+    Q_EMIT m_work->requestInit();
+    Q_EMIT m_work->requestActive();
+}
 
+void UpdateModule::createWorker()
+{
     m_workThread = QSharedPointer<QThread>(new QThread);
     m_model = new UpdateModel(this);
     m_work  = QSharedPointer<UpdateWorker>(new UpdateWorker(m_model));
@@ -66,6 +83,24 @@ void UpdateModule::preInitialize(bool sync, FrameProxyInterface::PushType pushty
 #ifndef DISABLE_SYS_UPDATE_MIRRORS
     connect(m_work.get(), &UpdateWorker::requestRefreshMirrors, m_work.get(), &UpdateWorker::refreshMirrors);
 #endif
+}
+
+void UpdateModule::preInitialize(bool sync, FrameProxyInterface::PushType pushtype)
+{
+    if (isUpdateDisabled()) {
+        qInfo() << "module: " << displayName() << " is disable now!";
+        setAvailable(false);
+        return;
+    }
+
+    Q_UNUSED(sync);
+    Q_UNUSED(pushtype);
+
+    // 工作线程可能已由 prefetch 启动
+    const bool prefetched = !m_work.isNull();
+    if (!prefetched)
+        createWorker();
+
     // 之前自动更新与更新提醒后端为同一处理逻辑，新需求分开处理，前端相应提示角标处理逻辑同步调整
     connect(m_model, &UpdateModel::updateNotifyChanged, this, [this](const bool state) {
         //关闭“自动提醒”，隐藏提示角标
@@ -84,6 +119,9 @@ void UpdateModule::preInitialize(bool sync, FrameProxyInterface::PushType pushty
     // 初始化更新小红点处理
     onUpdatablePackagesChanged(m_model->getUpdatablePackages());
     connect(m_model, &UpdateModel::updatablePackagesChanged, this, &UpdateModule::onUpdatablePackagesChanged);
+    // 工作线程提前读取的更新状态不会再发出变化信号，这里补上
+    if (prefetched)
+        notifyDisplayReminder(m_model->status());
 
     if (DSysInfo::uosEditionType() == DSysInfo::UosEuler) {
         m_frameProxy->setModuleVisible(this, false);
@@ -103,8 +141,10 @@ void UpdateModule::preInitialize(bool sync, FrameProxyInterface::PushType pushty
     });
 #endif
 
-    Q_EMIT m_work->requestInit();
-    Q_EMIT m_work->requestActive();
+    if (!prefetched) {
+        Q_EMIT m_work->requestInit();
+        Q_EMIT m_work->requestActive();
+    }
 
     addChildPageTrans();
     initSearchData();
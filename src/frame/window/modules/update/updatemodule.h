@@ -6,6 +6,7 @@
 
 #include "interface/moduleinterface.h"
 #include "modules/update/common.h"
+#include "window/moduleprefetcher.h"
 
 #include <QObject>
 #include <QGSettings>
@@ -29,12 +30,13 @@ namespace update {
 class UpdateWidget;
 class MirrorsWidget;
 
-class UpdateModule : public QObject, public ModuleInterface
+class UpdateModule : public QObject, public ModuleInterface, public ModulePrefetcher
 {
     Q_OBJECT
 public:
     UpdateModule(FrameProxyInterface *frameProxy, QObject *parent = nullptr);
     ~UpdateModule() override;
+    void prefetch(std::function<void()> done) override;
     virtual void preInitialize(bool sync = false, FrameProxyInterface::PushType = FrameProxyInterface::PushType::Normal) override;
     virtual void initialize() override;
     virtual const QString name() const override;
@@ -52,6 +54,8 @@ private:
     void initSearchData() override;
 
 private:
+    // 创建模型和工作线程中的 worker，init/activate 在工作线程中执行
+    void createWorker();
     void notifyDisplayReminder(dcc::update::UpdatesStatus status);
 
     /*!
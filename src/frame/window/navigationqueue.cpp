@@ -0,0 +1,59 @@
+// SPDX-FileCopyrightText: 2022 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include "navigationqueue.h"
+
+using namespace DCC_NAMESPACE;
+
+bool NavigationQueue::isReady(const QString &key) const
+{
+    return m_ready.contains(key);
+}
+
+void NavigationQueue::setReady(const QString &key, bool ready)
+{
+    if (!ready) {
+        m_ready.remove(key);
+        return;
+    }
+
+    if (isReady(key))
+        return;
+
+    m_ready.insert(key);
+
+    // 先取出可以执行的请求再依次执行，执行过程中可能会加入新的请求或就绪条件
+    QList<Request> runnable;
+    for (auto it = m_pending.begin(); it != m_pending.end();) {
+        if (isReady(it->prerequisites)) {
+            runnable << *it;
+            it = m_pending.erase(it);
+        } else {
+            ++it;
+        }
+    }
+
+    for (const Request &request : runnable)
+        request.action();
+}
+
+void NavigationQueue::enqueue(const QStringList &prerequisites, std::function<void()> action)
+{
+    if (isReady(prerequisites)) {
+        action();
+        return;
+    }
+
+    m_pending.append({ prerequisites, action });
+}
+
+bool NavigationQueue::isReady(const QStringList &prerequisites) const
+{
+    for (const QString &key : prerequisites) {
+        if (!isReady(key))
+            return false;
+    }
+
+    return true;
+}
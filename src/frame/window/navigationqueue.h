@@ -0,0 +1,41 @@
+// SPDX-FileCopyrightText: 2022 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#ifndef NAVIGATIONQUEUE_H
+#define NAVIGATIONQUEUE_H
+
+#include "interface/namespace.h"
+
+#include <QSet>
+#include <QStringList>
+
+#include <functional>
+
+namespace DCC_NAMESPACE {
+
+// 页面跳转请求队列
+// 跳转请求声明其依赖的就绪条件(模块预初始化完成、搜索数据加载完成等)，
+// 条件全部就绪时立即执行，否则挂起，等到最后一个条件通过 setReady 通知后执行且只执行一次
+class NavigationQueue
+{
+public:
+    bool isReady(const QString &key) const;
+    void setReady(const QString &key, bool ready = true);
+    void enqueue(const QStringList &prerequisites, std::function<void()> action);
+
+private:
+    bool isReady(const QStringList &prerequisites) const;
+
+private:
+    struct Request {
+        QStringList prerequisites;
+        std::function<void()> action;
+    };
+
+    QSet<QString> m_ready;
+    QList<Request> m_pending;
+};
+}
+
+#endif // NAVIGATIONQUEUE_H
@@ -0,0 +1,203 @@
+// SPDX-FileCopyrightText: 2022 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include "grandsearchquery.h"
+
+#include <QDBusConnection>
+#include <QDebug>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QMutexLocker>
+#include <QTimer>
+#include <QtConcurrent>
+
+const QString ControlCenterIconPath = "/usr/share/icons/bloom/apps/64/preferences-system.svg";
+const QString ControlCenterGroupName = "com.deepin.dde-grand-search.group.dde-control-center-setting";
+// 搜索数据未加载完成时最多等待的时间
+const int SnapshotTimeout = 5000;
+// 查询本身很快，少量线程即可，不与搜索数据加载争用全局线程池
+const int MaxQueryThreads = 2;
+
+using namespace DCC_NAMESPACE::search;
+
+GrandSearchQuery::GrandSearchQuery(QObject *parent)
+    : QObject(parent)
+    , m_pendingTimer(new QTimer(this))
+    , m_lastGeneration(0)
+{
+    m_pool.setMaxThreadCount(MaxQueryThreads);
+
+    // 从第一个排队的查询开始计时，超时后全部以空结果应答
+    m_pendingTimer->setSingleShot(true);
+    m_pendingTimer->setInterval(SnapshotTimeout);
+    connect(m_pendingTimer, &QTimer::timeout, this, [this] {
+        qDebug() << "grand search data not ready, pending queries:" << m_pending.size();
+        replyPending(QString());
+    });
+}
+
+void GrandSearchQuery::setSnapshot(SearchSnapshot::Ptr snapshot)
+{
+    m_snapshot = snapshot;
+    if (!m_snapshot || m_pending.isEmpty())
+        return;
+
+    m_pendingTimer->stop();
+    const QList<Query> pending = m_pending;
+    m_pending.clear();
+    for (const Query &query : pending)
+        dispatch(query, m_snapshot);
+}
+
+QString GrandSearchQuery::search(const QString &json, const QString &caller)
+{
+    // 在界面线程中调用时快照由本线程发布，不能等待
+    const quint64 generation = begin(caller);
+    const QString &result = run(json, m_snapshot, caller, generation);
+    finish(caller, generation);
+    return result;
+}
+
+void GrandSearchQuery::searchAsync(const QDBusMessage &message, const QString &json)
+{
+    // 序号在收到请求时分配，保证按请求顺序判断新旧
+    const Query query = { message, json, message.service(), begin(message.service()) };
+
+    // 同一调用者排队中的旧查询已被取代，立即应答
+    replyPending(query.caller);
+
+    if (m_snapshot) {
+        dispatch(query, m_snapshot);
+        return;
+    }
+
+    m_pending << query;
+    if (!m_pendingTimer->isActive())
+        m_pendingTimer->start();
+}
+
+void GrandSearchQuery::stop(const QString &caller)
+{
+    {
+        QMutexLocker locker(&m_mutex);
+        m_generations.remove(caller);
+    }
+
+    replyPending(caller);
+}
+
+QString GrandSearchQuery::search(const QDBusContext &context, const QString &json)
+{
+    if (!context.calledFromDBus())
+        return search(json);
+
+    // 在线程池中匹配并延迟应答，界面线程繁忙时不影响大搜索的响应
+    context.setDelayedReply(true);
+    searchAsync(context.message(), json);
+    return QString();
+}
+
+void GrandSearchQuery::stop(const QDBusContext &context)
+{
+    // 只取消发出 Stop 的调用者自己的查询
+    stop(context.calledFromDBus() ? context.message().service() : QString());
+}
+
+quint64 GrandSearchQuery::begin(const QString &caller)
+{
+    // 序号全局递增不重复，调用者的记录移除后也不会与旧查询混淆
+    QMutexLocker locker(&m_mutex);
+    m_generations[caller] = ++m_lastGeneration;
+    return m_lastGeneration;
+}
+
+void GrandSearchQuery::finish(const QString &caller, quint64 generation)
+{
+    QMutexLocker locker(&m_mutex);
+    auto it = m_generations.find(caller);
+    if (it != m_generations.end() && it.value() == generation)
+        m_generations.erase(it);
+}
+
+bool GrandSearchQuery::isSuperseded(const QString &caller, quint64 generation)
+{
+    QMutexLocker locker(&m_mutex);
+    return m_generations.value(caller) != generation;
+}
+
+void GrandSearchQuery::replyPending(const QString &caller)
+{
+    for (auto it = m_pending.begin(); it != m_pending.end();) {
+        if (!caller.isEmpty() && it->caller != caller) {
+            ++it;
+            continue;
+        }
+
+        QDBusConnection::sessionBus().send(it->message.createReply(run(it->json, nullptr, it->caller, it->generation)));
+        finish(it->caller, it->generation);
+        it = m_pending.erase(it);
+    }
+
+    if (m_pending.isEmpty())
+        m_pendingTimer->stop();
+}
+
+void GrandSearchQuery::dispatch(const Query &query, SearchSnapshot::Ptr snapshot)
+{
+    QtConcurrent::run(&m_pool, [this, query, snapshot] {
+        const QString &result = run(query.json, snapshot, query.caller, query.generation);
+        QDBusConnection::sessionBus().send(query.message.createReply(result));
+        finish(query.caller, query.generation);
+    });
+}
+
+QString GrandSearchQuery::run(const QString &json, SearchSnapshot::Ptr snapshot, const QString &caller, quint64 generation)
+{
+    //解析输入的json值
+    QJsonDocument jsonDocument = QJsonDocument::fromJson(json.toUtf8());
+    if (jsonDocument.isNull())
+        return QString();
+
+    QJsonObject jsonObject = jsonDocument.object();
+    const QString &text = jsonObject.value("cont").toString();
+    const int maxResults = jsonObject.value("maxResults").toInt(-1);
+
+    //处理搜索任务, 被同一调用者的新请求取代时返回空结果
+    QStringList lstMsg;
+    if (snapshot && !isSuperseded(caller, generation)) {
+        for (int row : snapshot->search(text, maxResults))
+            lstMsg << snapshot->rowTexts.value(row);
+    }
+
+    if (isSuperseded(caller, generation)) {
+        qDebug() << "grand search query superseded:" << text;
+        lstMsg.clear();
+    }
+
+    QJsonArray items;
+    for (int i = 0; i < lstMsg.size(); i++) {
+        QJsonObject jsonObj;
+        jsonObj.insert("item", lstMsg[i]);
+        jsonObj.insert("name", lstMsg[i]);
+        jsonObj.insert("icon", ControlCenterIconPath);
+        jsonObj.insert("type", "application/x-dde-control-center-xx");
+
+        items.insert(i, jsonObj);
+    }
+
+    QJsonObject objCont;
+    objCont.insert("group", ControlCenterGroupName);
+    objCont.insert("items", items);
+
+    QJsonArray arrConts;
+    arrConts.insert(0, objCont);
+
+    QJsonObject jsonResults;
+    jsonResults.insert("ver", jsonObject.value("ver"));
+    jsonResults.insert("mID", jsonObject.value("mID"));
+    jsonResults.insert("cont", arrConts);
+
+    return QJsonDocument(jsonResults).toJson(QJsonDocument::Compact);
+}
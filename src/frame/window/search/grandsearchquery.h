@@ -0,0 +1,79 @@
+// SPDX-FileCopyrightText: 2022 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#pragma once
+
+#include "interface/namespace.h"
+#include "searchengine.h"
+
+#include <QObject>
+#include <QHash>
+#include <QList>
+#include <QMutex>
+#include <QDBusContext>
+#include <QDBusMessage>
+#include <QThreadPool>
+
+QT_BEGIN_NAMESPACE
+class QTimer;
+QT_END_NAMESPACE
+
+namespace DCC_NAMESPACE {
+namespace search {
+
+// 桌面大搜索的查询服务
+// 查询基于 SearchModel 发布的只读快照，在专用线程池中执行，不依赖界面线程；
+// 搜索数据未加载完成时查询在界面线程中排队，发布快照后再分派，不占用线程等待。
+// 同一调用者的新查询或 Stop 会取消其尚未完成的旧查询，旧查询返回空结果
+class GrandSearchQuery : public QObject
+{
+    Q_OBJECT
+public:
+    explicit GrandSearchQuery(QObject *parent = nullptr);
+
+    // 以下接口只能在界面线程中调用
+    void setSnapshot(SearchSnapshot::Ptr snapshot);
+
+    // 同步查询，返回应答的 json 字符串
+    QString search(const QString &json, const QString &caller = QString());
+    void stop(const QString &caller);
+
+    // 处理 D-Bus 方法调用，context 为接收调用的对象(适配器的调用上下文由 Qt 设置在其 parent 上)；
+    // 通过 D-Bus 调用时延迟应答并在线程池中查询，调用者取自消息的发送方，否则同步查询
+    QString search(const QDBusContext &context, const QString &json);
+    void stop(const QDBusContext &context);
+
+private:
+    struct Query {
+        QDBusMessage message;
+        QString json;
+        QString caller;
+        quint64 generation;
+    };
+
+    // 异步查询，完成后通过 message 延迟应答
+    void searchAsync(const QDBusMessage &message, const QString &json);
+    quint64 begin(const QString &caller);
+    void finish(const QString &caller, quint64 generation);
+    bool isSuperseded(const QString &caller, quint64 generation);
+    // 以空结果应答等待中的查询，caller 为空时应答全部
+    void replyPending(const QString &caller);
+    void dispatch(const Query &query, SearchSnapshot::Ptr snapshot);
+    QString run(const QString &json, SearchSnapshot::Ptr snapshot, const QString &caller, quint64 generation);
+
+private:
+    SearchSnapshot::Ptr m_snapshot;         // 只在界面线程中访问，查询线程使用分派时的快照
+    QList<Query> m_pending;                 // 等待搜索数据加载的查询
+    QTimer *m_pendingTimer;
+
+    QMutex m_mutex;
+    quint64 m_lastGeneration;
+    QHash<QString, quint64> m_generations;  // 调用者 -> 尚未完成的最新查询序号，查询完成后移除
+
+    // 最后声明，析构时最先等待查询线程结束
+    QThreadPool m_pool;
+};
+
+}// namespace search
+}// namespace DCC_NAMESPACE
@@ -0,0 +1,138 @@
+// SPDX-FileCopyrightText: 2022 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include "searchengine.h"
+
+#include "modules/pinyinconverter.h"
+
+#include <algorithm>
+
+const int MaxGramLength = 3;
+
+using namespace DCC_NAMESPACE::search;
+
+void SearchEngine::clear()
+{
+    m_entries.clear();
+    m_grams.clear();
+}
+
+void SearchEngine::addEntry(int row, const QString &text, bool pinyin)
+{
+    Entry entry;
+    entry.row = row;
+    entry.keys << text.toLower();
+
+    if (pinyin) {
+        QString full;
+        QString initials;
+        dcc::PinyinConverter::convert(text, full, initials);
+        full = full.toLower();
+        if (full != entry.keys.first())
+            entry.keys << full;
+        if (!initials.isEmpty() && !entry.keys.contains(initials))
+            entry.keys << initials;
+    }
+
+    const int id = m_entries.size();
+    for (const QString &key : entry.keys) {
+        for (int n = 1; n <= MaxGramLength; ++n) {
+            for (int i = 0; i + n <= key.size(); ++i) {
+                QVector<int> &posting = m_grams[key.mid(i, n)];
+                if (posting.isEmpty() || posting.last() != id)
+                    posting.append(id);
+            }
+        }
+    }
+
+    m_entries.append(entry);
+}
+
+QList<int> SearchEngine::query(const QString &text, int maxResults) const
+{
+    QList<int> rows;
+    const QString &key = text.toLower();
+    if (key.isEmpty())
+        return rows;
+
+    // 短查询直接取倒排表，长查询取所有三字 n-gram 倒排表的交集
+    QVector<int> candidates;
+    if (key.size() <= MaxGramLength) {
+        candidates = m_grams.value(key);
+    } else {
+        QList<const QVector<int> *> postings;
+        for (int i = 0; i + MaxGramLength <= key.size(); ++i) {
+            auto it = m_grams.constFind(key.mid(i, MaxGramLength));
+            if (it == m_grams.constEnd())
+                return rows;
+            postings << &it.value();
+        }
+
+        std::sort(postings.begin(), postings.end(), [](const QVector<int> *a, const QVector<int> *b) {
+            return a->size() < b->size();
+        });
+
+        candidates = *postings.first();
+        for (int i = 1; i < postings.size() && !candidates.isEmpty(); ++i) {
+            QVector<int> result;
+            std::set_intersection(candidates.cbegin(), candidates.cend(),
+                                  postings.at(i)->cbegin(), postings.at(i)->cend(),
+                                  std::back_inserter(result));
+            candidates.swap(result);
+        }
+    }
+
+    struct Match {
+        int score;
+        int pos;
+        int row;
+    };
+
+    QVector<Match> matches;
+    for (int id : candidates) {
+        const Entry &entry = m_entries.at(id);
+        for (int k = 0; k < entry.keys.size(); ++k) {
+            const int pos = entry.keys.at(k).indexOf(key);
+            if (pos < 0)
+                continue;
+
+            matches.append({ k * 2 + (pos == 0 ? 0 : 1), pos, entry.row });
+            break;
+        }
+    }
+
+    std::stable_sort(matches.begin(), matches.end(), [](const Match &a, const Match &b) {
+        if (a.score != b.score)
+            return a.score < b.score;
+        if (a.pos != b.pos)
+            return a.pos < b.pos;
+        return a.row < b.row;
+    });
+
+    for (const Match &match : matches) {
+        if (maxResults >= 0 && rows.size() >= maxResults)
+            break;
+        rows << match.row;
+    }
+
+    return rows;
+}
+
+QList<int> SearchSnapshot::search(const QString &text, int maxResults) const
+{
+    QList<int> rows;
+    if (!engine || maxResults == 0)
+        return rows;
+
+    for (int row : engine->query(text)) {
+        if (!entryVisible.value(rowEntries.value(row)))
+            continue;
+
+        rows << row;
+        if (maxResults > 0 && rows.size() >= maxResults)
+            break;
+    }
+
+    return rows;
+}
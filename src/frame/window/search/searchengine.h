@@ -0,0 +1,55 @@
+// SPDX-FileCopyrightText: 2022 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#pragma once
+
+#include "interface/namespace.h"
+
+#include <QHash>
+#include <QString>
+#include <QStringList>
+#include <QVector>
+
+#include <memory>
+
+namespace DCC_NAMESPACE {
+namespace search {
+
+// 搜索数据倒排索引
+// 每条数据以原文、全拼、拼音首字母作为检索键，对检索键的 1~3 字 n-gram 建立倒排表，
+// 查询时只校验 n-gram 倒排表交集中的条目，耗时与数据总量无关
+class SearchEngine
+{
+public:
+    void clear();
+    // 为模型中的 row 行建立索引，pinyin 为 true 时同时索引全拼及拼音首字母
+    void addEntry(int row, const QString &text, bool pinyin);
+    // 返回包含 text 的行(忽略大小写)，按匹配程度排序：原文优先于全拼、全拼优先于首字母，前缀匹配优先
+    QList<int> query(const QString &text, int maxResults = -1) const;
+
+private:
+    struct Entry {
+        int row;
+        QStringList keys;   // 小写检索键，依次为原文、全拼、拼音首字母
+    };
+
+    QVector<Entry> m_entries;
+    QHash<QString, QVector<int>> m_grams;   // n-gram -> 条目下标(升序)
+};
+
+// 搜索数据的只读快照，索引建立后不再修改，可以在其他线程中查询
+struct SearchSnapshot {
+    typedef std::shared_ptr<const SearchSnapshot> Ptr;
+
+    // 返回匹配 text 且可见的行，按匹配程度排序
+    QList<int> search(const QString &text, int maxResults = -1) const;
+
+    std::shared_ptr<const SearchEngine> engine;
+    QStringList rowTexts;       // 行 -> 完整的搜索结果文本
+    QVector<int> rowEntries;    // 行 -> 搜索数据条目
+    QVector<bool> entryVisible; // 搜索数据条目是否可见
+};
+
+}// namespace search
+}// namespace DCC_NAMESPACE
@@ -0,0 +1,184 @@
+// SPDX-FileCopyrightText: 2022 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include "searchindex.h"
+
+#include <QCryptographicHash>
+#include <QDataStream>
+#include <QDateTime>
+#include <QDebug>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QSaveFile>
+#include <QStandardPaths>
+#include <QXmlStreamReader>
+
+const QString XML_Source = "source";
+const QString XML_Title = "translation";
+const QString XML_Numerusform = "numerusform";
+const QString XML_Explain_Path = "extra-contents_path";
+const QString XML_Child_Path = "extra-child_page";
+const QString XML_ChildHide_Path = "extra-child_page_hide";
+
+const quint32 IndexMagic = 0x44434349; // "DCCI"
+const quint32 IndexVersion = 1;
+
+using namespace DCC_NAMESPACE::search;
+
+bool SearchIndex::load(const QString &tsPath, SearchIndexData &data)
+{
+    QFileInfo info(tsPath);
+    if (!info.exists()) {
+        qDebug() << " [SearchIndex] File not exist:" << tsPath;
+        return false;
+    }
+
+    const qint64 mtime = info.lastModified().toMSecsSinceEpoch();
+    if (readCache(tsPath, mtime, info.size(), data))
+        return true;
+
+    data = SearchIndexData();
+    if (!parse(tsPath, data))
+        return false;
+
+    writeCache(tsPath, mtime, info.size(), data);
+    return true;
+}
+
+QString SearchIndex::cachePath(const QString &tsPath)
+{
+    const QByteArray &hash = QCryptographicHash::hash(tsPath.toUtf8(), QCryptographicHash::Md5).toHex();
+    return QString("%1/deepin/dde-control-center/search/%2.idx")
+            .arg(QStandardPaths::writableLocation(QStandardPaths::GenericCacheLocation))
+            .arg(QString::fromLatin1(hash));
+}
+
+bool SearchIndex::readCache(const QString &tsPath, qint64 mtime, qint64 size, SearchIndexData &data)
+{
+    QFile file(cachePath(tsPath));
+    if (!file.open(QIODevice::ReadOnly))
+        return false;
+
+    uchar *addr = file.map(0, file.size());
+    if (!addr)
+        return false;
+
+    // 直接在映射的内存上反序列化，避免先整体读入
+    const QByteArray &raw = QByteArray::fromRawData(reinterpret_cast<const char *>(addr), static_cast<int>(file.size()));
+    QDataStream in(raw);
+    in.setVersion(QDataStream::Qt_5_0);
+
+    quint32 magic = 0;
+    quint32 version = 0;
+    QString path;
+    qint64 cacheMtime = 0;
+    qint64 cacheSize = 0;
+    in >> magic >> version;
+    if (magic != IndexMagic || version != IndexVersion) {
+        file.unmap(addr);
+        return false;
+    }
+
+    in >> path >> cacheMtime >> cacheSize;
+    if (path != tsPath || cacheMtime != mtime || cacheSize != size) {
+        file.unmap(addr);
+        return false;
+    }
+
+    quint32 count = 0;
+    in >> data.childPages >> data.hideChildPages >> count;
+    data.entries.reserve(static_cast<int>(count));
+    for (quint32 i = 0; i < count && in.status() == QDataStream::Ok; ++i) {
+        SearchIndexEntry entry;
+        in >> entry.source >> entry.translateContent >> entry.childPage >> entry.fullPagePath;
+        data.entries << entry;
+    }
+
+    const bool ok = in.status() == QDataStream::Ok;
+    file.unmap(addr);
+    if (!ok) {
+        qWarning() << " [SearchIndex] Broken index for" << tsPath;
+        data = SearchIndexData();
+    }
+
+    return ok;
+}
+
+void SearchIndex::writeCache(const QString &tsPath, qint64 mtime, qint64 size, const SearchIndexData &data)
+{
+    const QString &path = cachePath(tsPath);
+    QDir().mkpath(QFileInfo(path).absolutePath());
+
+    // 多个实例可能同时重建索引，写入临时文件后再替换
+    QSaveFile file(path);
+    if (!file.open(QIODevice::WriteOnly)) {
+        qWarning() << " [SearchIndex] Failed to write index:" << path;
+        return;
+    }
+
+    QDataStream out(&file);
+    out.setVersion(QDataStream::Qt_5_0);
+    out << IndexMagic << IndexVersion << tsPath << mtime << size;
+    out << data.childPages << data.hideChildPages << static_cast<quint32>(data.entries.size());
+    for (const SearchIndexEntry &entry : data.entries)
+        out << entry.source << entry.translateContent << entry.childPage << entry.fullPagePath;
+
+    file.commit();
+}
+
+bool SearchIndex::parse(const QString &tsPath, SearchIndexData &data)
+{
+    QFile file(tsPath);
+    if (!file.open(QIODevice::ReadOnly | QIODevice::Text)) {
+        qDebug() << " [SearchIndex] File open failed:" << tsPath;
+        return false;
+    }
+
+    QXmlStreamReader xmlRead(&file);
+    SearchIndexEntry entry;
+    QString xmlExplain;
+
+    //遍历XML文件,读取每一行的xml数据都会
+    //先进入StartElement读取出<>中的内容;
+    //再进入Characters读取出中间数据部分;
+    //最后进入时进入EndElement读取出</>中的内容
+    while (!xmlRead.atEnd()) {
+        switch (xmlRead.readNext()) {
+        case QXmlStreamReader::StartElement:
+            xmlExplain = xmlRead.name().toString();
+            break;
+        case QXmlStreamReader::Characters: {
+            if (xmlRead.isWhitespace())
+                break;
+
+            const QString &text = xmlRead.text().toString();
+            if (xmlExplain == XML_Source) {
+                entry.translateContent = QString(text).remove('/').trimmed();
+                entry.source = text;
+            } else if (xmlExplain == XML_Title || xmlExplain == XML_Numerusform) {
+                // translation not nullptr can set it
+                if (!text.isEmpty())
+                    entry.translateContent = QString(text).remove('/').trimmed();
+            } else if (xmlExplain == XML_Child_Path) {
+                entry.childPage = text;
+                if (!data.childPages.contains(text))
+                    data.childPages << text;
+            } else if (xmlExplain == XML_ChildHide_Path) {
+                if (!data.hideChildPages.contains(text))
+                    data.hideChildPages << text;
+            } else if (xmlExplain == XML_Explain_Path) {
+                entry.fullPagePath = text;
+                data.entries << entry;
+                entry = SearchIndexEntry();
+            }
+            break;
+        }
+        default:
+            break;
+        }
+    }
+
+    return true;
+}
@@ -0,0 +1,47 @@
+// SPDX-FileCopyrightText: 2022 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#pragma once
+
+#include "interface/namespace.h"
+
+#include <QString>
+#include <QStringList>
+#include <QList>
+
+namespace DCC_NAMESPACE {
+namespace search {
+
+// 从 .ts 文件中解析出的一条原始搜索数据，与模块名翻译等运行时状态无关
+struct SearchIndexEntry {
+    QString source;             // <source> 原文
+    QString translateContent;   // 翻译文本(已去除'/')，未翻译时为原文
+    QString childPage;          // <extra-child_page> 原文
+    QString fullPagePath;       // <extra-contents_path>
+};
+
+struct SearchIndexData {
+    QList<SearchIndexEntry> entries;
+    QStringList childPages;     // 出现过的所有 <extra-child_page>，按出现顺序
+    QStringList hideChildPages; // 出现过的所有 <extra-child_page_hide>
+};
+
+// 搜索数据索引
+// 每个 .ts 文件解析后以二进制形式缓存在 ~/.cache/deepin/dde-control-center/search 下，
+// 以文件路径(已包含语言)、修改时间和大小校验，命中时通过内存映射读取，不再解析 XML
+class SearchIndex
+{
+public:
+    // 读取 tsPath 对应的搜索数据，缓存失效时解析 XML 并重建缓存；文件不存在时返回 false
+    static bool load(const QString &tsPath, SearchIndexData &data);
+
+private:
+    static QString cachePath(const QString &tsPath);
+    static bool readCache(const QString &tsPath, qint64 mtime, qint64 size, SearchIndexData &data);
+    static void writeCache(const QString &tsPath, qint64 mtime, qint64 size, const SearchIndexData &data);
+    static bool parse(const QString &tsPath, SearchIndexData &data);
+};
+
+}// namespace search
+}// namespace DCC_NAMESPACE
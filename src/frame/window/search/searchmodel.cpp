@@ -3,23 +3,17 @@
 // SPDX-License-Identifier: LGPL-3.0-or-later
 
 #include "searchmodel.h"
+#include "searchindex.h"
 #include "window/utils.h"
 
-#include <DPinyin>
 #include <QDebug>
-#include <QRegularExpression>
 #include <QFutureWatcher>
 #include <QtConcurrent>
 
 #define DEBUG_XML_SWITCH 0
 
-const QString XML_Source = "source";
-const QString XML_Title = "translation";
-const QString XML_Numerusform = "numerusform";
-const QString XML_Explain_Path = "extra-contents_path";
-const QString XML_Child_Path = "extra-child_page";
-const QString XML_ChildHide_Path = "extra-child_page_hide";
 const int TxtWidth = 310;
+const QString SearchDataReady = "searchdata";
 
 using namespace DCC_NAMESPACE;
 using namespace DCC_NAMESPACE::search;
@@ -30,6 +24,7 @@ SearchModel::SearchModel(QObject *parent)
     , m_bIstextEdited(false)
     , m_dataUpdateCompleted(false)
     , m_calLenthLabel(new QLabel)
+    , m_engine(std::make_shared<SearchEngine>())
     , m_fontSize(0)
 {
     //左边是从从xml解析出来的数据，右边是需要被翻译成的数据；
@@ -65,7 +60,8 @@ void SearchModel::getJumpPath(QString &moduleName, QString &pageName, const QStr
         SearchBoxStruct::Ptr data = getModuleBtnString(searchName);
         if (data->translateContent != "" && data->fullPagePath != "") {
             for (int i = 0; i < m_EnterNewPagelist.count(); i++) {
-                if (m_EnterNewPagelist[i]->translateContent == data->fullPagePath
+                if (m_entryVisible[i]
+                        && m_EnterNewPagelist[i]->translateContent == data->fullPagePath
                         && m_EnterNewPagelist[i]->childPageName.isEmpty()
                         && m_EnterNewPagelist[i]->actualModuleName == data->translateContent) {
                     moduleName = data->actualModuleName;
@@ -80,8 +76,9 @@ void SearchModel::getJumpPath(QString &moduleName, QString &pageName, const QStr
 bool SearchModel::jumpContentPathWidget(const QString &path)
 {
     qDebug() << Q_FUNC_INFO << path;
+    //搜索数据加载完成后再跳转
     if (!m_dataUpdateCompleted) {
-        QTimer::singleShot(10, this, [this, path]() {
+        m_pendingJumps.enqueue({ SearchDataReady }, [this, path] {
             jumpContentPathWidget(path);
         });
         return true;
@@ -113,9 +110,9 @@ bool SearchModel::jumpContentPathWidget(const QString &path)
             isContinue = true;
         }
     } else {
-        //searchEndData不为空，且搜索数据包含在m_TxtListAll可以执行
+        //searchEndData不为空，且搜索数据包含在可见的搜索数据中可以执行
         //对非xml添加的搜索数据内容不作处理, 不在list里面就停止
-        if (m_TxtListAll.contains(searchEndData))
+        if (m_visibleTxtCount.contains(searchEndData))
             isContinue = true;
     }
 
@@ -126,6 +123,10 @@ bool SearchModel::jumpContentPathWidget(const QString &path)
     QString searchModule = path.section('-', 0, 1).remove('-').trimmed();
 
     for (int i = 0; i < m_EnterNewPagelist.count(); i++) {
+        if (!m_entryVisible[i]) {
+            continue;
+        }
+
         //SearchBoxStruct::Ptr data = m_EnterNewPagelist[i]; //used to debug
         /* m_EnterNewPagelist[i] 数据例子
            source : Interface
@@ -177,125 +178,192 @@ bool SearchModel::jumpContentPathWidget(const QString &path)
     return false;
 }
 
-void SearchModel::loadxml(const QString module)
+//建立全部搜索数据的模型行及索引，只在语言数据加载完成或字体大小变化时调用
+//模块、子页面、详细数据的可见性变化由 updateEntriesVisible 增量处理
+void SearchModel::loadxml()
 {
-    Q_UNUSED(module)
-
+    //已发布的快照仍持有旧索引，重新创建而不是清空
+    m_engine = std::make_shared<SearchEngine>();
+    m_rowTexts.clear();
     clear(); // It doesn't seem to leak memory
     m_EnterNewPagelist.clear();
-    m_inputList.clear();
-    m_TxtListAll.clear();
+    m_entryVisible.clear();
+    m_rowEntries.clear();
+    m_moduleEntries.clear();
+    m_widgetEntries.clear();
+    m_detailEntries.clear();
+    m_visibleTxtCount.clear();
     m_scaleTxtMap.clear();
 
     //添加一项空数据，为了防止使用setText输入错误数据时直接跳转到list中正确的第一个页面
     m_EnterNewPagelist.append(std::make_shared<SearchBoxStruct>());
-    m_inputList.append(SearchDataStruct());
+    m_entryVisible.append(true);
     appendRow(new QStandardItem(""));
-
-    bool isPlugins = false;
-    bool bIsContinue = false;
-    bool bIsTwoLevel = false;
-    QString searchModule = "";
-    QString searchData = "";
+    m_rowTexts.append("");
+    m_rowEntries.append(0);
 
     for (SearchBoxStruct::Ptr searchBoxStrcut : m_originList) {
-
-        searchModule = searchBoxStrcut->fullPagePath.section('/', 0, 1).remove('/').trimmed();
-        searchData = searchBoxStrcut->fullPagePath.section('/', 2, -1).remove('/').trimmed();
-
-        //插件数据默认都显示 --> 未解决历史遗留问题，修改接口后依旧兼容旧接口； 如果统一使用setxxxVisible可以删除这里
-        if (!m_transPlusData.value(searchModule).isEmpty() || !m_transPlusData.value(searchData).isEmpty()) {
-            qInfo() << " [loadxml] Plugins data :"
-                       << searchBoxStrcut->actualModuleName
-                       << searchBoxStrcut->childPageName
-                       <<searchBoxStrcut->fullPagePath
-                       <<searchBoxStrcut->source
-                       <<searchBoxStrcut->translateContent;
-            if (!specialProcessData(searchBoxStrcut)) {
-                isPlugins = true;
-            }
-        }
-
-        if (!isPlugins) {
-            bool moduleVisible = getModuleVisible(searchBoxStrcut->actualModuleName);
-            if (!moduleVisible) {
-                continue;
-            }
-
-            bIsContinue = true;
-            bIsTwoLevel = false;
-            do {
-                if (searchBoxStrcut->childPageName == "") {
-                    //这样的数据都是只有二级菜单，需要用到source再进行判断，且source需要进行多语言翻译
-                    searchBoxStrcut->childPageName = m_transChildPageName.value(searchBoxStrcut->source);
-                    bIsTwoLevel = true;
-                }
-
-                bool widgetVisible = getWidgetVisible(searchBoxStrcut->actualModuleName, searchBoxStrcut->childPageName);
-
-                if (!widgetVisible) {
-                    bIsContinue = false;
-                    if (bIsTwoLevel && searchBoxStrcut->childPageName != "")
-                        searchBoxStrcut->childPageName = "";
-                    break;
-                }
-
-                if (bIsTwoLevel) {
-                    //数据用完后需要还原, 此时表示只有两级目录需要退出判断
-                    searchBoxStrcut->childPageName = "";
-                    bIsContinue = true;
-                    break;
-                }
-
-                bool detailVisible = getDetailVisible(searchBoxStrcut->actualModuleName, searchBoxStrcut->childPageName, searchBoxStrcut->translateContent);
-                if (!detailVisible) {
-                    bIsContinue = false;
-                    break;
-                }
-
-            } while (0);
-
-            if (!bIsContinue) {
-                continue;
-            }
-        }
-
+        const int id = m_EnterNewPagelist.count();
         m_EnterNewPagelist.append(searchBoxStrcut);
-        isPlugins = false;
+        indexEntry(id);
 
-        m_TxtListAll.append(searchBoxStrcut->translateContent);
+        const bool visible = isEntryVisible(searchBoxStrcut);
+        m_entryVisible.append(visible);
+        if (visible) {
+            m_visibleTxtCount[searchBoxStrcut->translateContent]++;
+        }
 
         // Add search result content
+        const int rows = rowCount();
         if (!m_bIsChinese) {
             auto icon = m_iconMap.find(searchBoxStrcut->fullPagePath.section('/', 1, 1));
             if (icon == m_iconMap.end()) {
                 continue;
             }
 
+            QString txt;
             if ("" == searchBoxStrcut->childPageName) {
-                appendRow(new QStandardItem(icon.value(), getNormalText(QString("%1 --> %2")
-                                                                        .arg(searchBoxStrcut->actualModuleName)
-                                                                        .arg(searchBoxStrcut->translateContent))));
+                txt = QString("%1 --> %2")
+                        .arg(searchBoxStrcut->actualModuleName)
+                        .arg(searchBoxStrcut->translateContent);
             }
             else {
-                appendRow(new QStandardItem(
-                    icon.value(), getNormalText(QString("%1 --> %2 / %3")
-                                                .arg(searchBoxStrcut->actualModuleName)
-                                                .arg(searchBoxStrcut->childPageName)
-                                                .arg(searchBoxStrcut->translateContent))));
+                txt = QString("%1 --> %2 / %3")
+                        .arg(searchBoxStrcut->actualModuleName)
+                        .arg(searchBoxStrcut->childPageName)
+                        .arg(searchBoxStrcut->translateContent);
             }
+            appendRow(new QStandardItem(icon.value(), getNormalText(txt)));
 
             // 设置图标数据
             setData(index(rowCount() - 1, 0), icon->name(), Qt::UserRole + 1);
+            // 以未省略的完整文本建立索引
+            m_engine->addEntry(rowCount() - 1, txt, false);
+            m_rowTexts.append(txt);
         }
         else {
             appendChineseData(searchBoxStrcut);
         }
 
-        m_TxtListAll.append(searchBoxStrcut->translateContent.remove('/').trimmed());
+        if (rowCount() > rows) {
+            m_rowEntries.append(id);
+        }
+    }
+
+    Q_EMIT searchDataUpdated();
+}
+
+//插件数据默认都显示 --> 未解决历史遗留问题，修改接口后依旧兼容旧接口； 如果统一使用setxxxVisible可以删除这里
+bool SearchModel::isPluginEntry(SearchBoxStruct::Ptr data) const
+{
+    const QString &searchModule = data->fullPagePath.section('/', 0, 1).remove('/').trimmed();
+    const QString &searchData = data->fullPagePath.section('/', 2, -1).remove('/').trimmed();
+
+    if (m_transPlusData.value(searchModule).isEmpty() && m_transPlusData.value(searchData).isEmpty()) {
+        return false;
+    }
+
+    return !specialProcessData(data);
+}
+
+//搜索数据所属的子页面，childPageName为空的数据只有二级菜单，需要用source翻译出子页面
+QString SearchModel::entryWidget(SearchBoxStruct::Ptr data, bool *twoLevel) const
+{
+    const bool bIsTwoLevel = data->childPageName == "";
+    if (twoLevel) {
+        *twoLevel = bIsTwoLevel;
+    }
+
+    return bIsTwoLevel ? m_transChildPageName.value(data->source) : data->childPageName;
+}
+
+bool SearchModel::isEntryVisible(SearchBoxStruct::Ptr data)
+{
+    if (isPluginEntry(data)) {
+        return true;
+    }
+
+    if (!getModuleVisible(data->actualModuleName)) {
+        return false;
+    }
+
+    bool bIsTwoLevel = false;
+    const QString &widget = entryWidget(data, &bIsTwoLevel);
+    if (!getWidgetVisible(data->actualModuleName, widget)) {
+        return false;
+    }
+
+    //只有两级目录时不需要判断详细数据
+    if (bIsTwoLevel) {
+        return true;
+    }
+
+    return getDetailVisible(data->actualModuleName, widget, data->translateContent);
+}
+
+//记录条目可见性依赖的模块、子页面、详细数据
+void SearchModel::indexEntry(int id)
+{
+    SearchBoxStruct::Ptr data = m_EnterNewPagelist[id];
+    if (isPluginEntry(data)) {
+        qInfo() << " [loadxml] Plugins data :"
+                   << data->actualModuleName
+                   << data->childPageName
+                   << data->fullPagePath
+                   << data->source
+                   << data->translateContent;
+        return;
+    }
+
+    bool bIsTwoLevel = false;
+    const SearchWidgetKey widgetKey(data->actualModuleName, entryWidget(data, &bIsTwoLevel));
+    m_moduleEntries.insert(data->actualModuleName, id);
+    m_widgetEntries.insert(widgetKey, id);
+    if (!bIsTwoLevel) {
+        m_detailEntries.insert(SearchDetailKey(widgetKey, data->translateContent), id);
+    }
+}
+
+//重新计算受影响条目的可见性
+void SearchModel::updateEntriesVisible(const QList<int> &entries)
+{
+    bool changed = false;
+    for (int id : entries) {
+        SearchBoxStruct::Ptr data = m_EnterNewPagelist[id];
+        const bool visible = isEntryVisible(data);
+        if (m_entryVisible[id] == visible) {
+            continue;
+        }
+
+        m_entryVisible[id] = visible;
+        changed = true;
+        if (visible) {
+            m_visibleTxtCount[data->translateContent]++;
+        } else if (--m_visibleTxtCount[data->translateContent] <= 0) {
+            m_visibleTxtCount.remove(data->translateContent);
+        }
+    }
+
+    if (changed) {
+        Q_EMIT searchVisibilityChanged();
     }
 }
 
+QList<int> SearchModel::search(const QString &text, int maxResults) const
+{
+    return snapshot()->search(text, maxResults);
+}
+
+SearchSnapshot::Ptr SearchModel::snapshot() const
+{
+    auto snapshot = std::make_shared<SearchSnapshot>();
+    snapshot->engine = m_engine;
+    snapshot->rowTexts = m_rowTexts;
+    snapshot->rowEntries = m_rowEntries;
+    snapshot->entryVisible = m_entryVisible;
+    return snapshot;
+}
+
 //Follow display content to Analysis SearchBoxStruct data
 SearchBoxStruct::Ptr SearchModel::getModuleBtnString(QString value)
 {
@@ -309,7 +377,7 @@ SearchBoxStruct::Ptr SearchModel::getModuleBtnString(QString value)
     if (data->fullPagePath.contains('/', Qt::CaseInsensitive)) {
         QString strTemp = data->fullPagePath.section('/', 0, 0).remove('/').trimmed();
         //修复最终字段存在'/'无法跳转的问题
-        if (this->m_TxtListAll.contains(strTemp)) {
+        if (this->m_visibleTxtCount.contains(strTemp)) {
             data->fullPagePath = strTemp;
         }
     }
@@ -343,58 +411,6 @@ QString SearchModel::getModulesName(const QString &name, bool state)
     return strResult;
 }
 
-QString SearchModel::removeDigital(QString input)
-{
-    if ("" == input)
-        return "";
-
-    QString value = "";
-    QByteArray ba = input.toLocal8Bit();
-    char *data = nullptr;
-    data = ba.data();
-    while (*data) {
-        if (!(*data >= '0' && *data <= '9')) {
-            value += *data;
-        }
-        data++;
-    }
-
-    return value;
-}
-
-QString SearchModel::transPinyinToChinese(const QString &pinyin)
-{
-    QString value = pinyin;
-
-    //遍历"汉字-拼音"列表,将存在的"拼音"转换为"汉字"
-    auto res = std::find_if(m_inputList.begin(), m_inputList.end(), [=] (const SearchDataStruct data)->bool{
-            return value == data.pinyin;
-        });
-
-        if (res != m_inputList.end()) {
-            value =(*res).chiese;
-        }
-
-    return value;
-}
-
-QString SearchModel::containTxtData(QString txt)
-{
-    QString value = txt;
-
-    //遍历"汉字-拼音"列表,将存在的"拼音"转换为"汉字"
-    auto res = std::find_if(m_inputList.begin(), m_inputList.end(), [=] (const SearchDataStruct data)->bool{
-                return (data.chiese.contains(txt, Qt::CaseInsensitive) ||
-                        data.pinyin.contains(txt, Qt::CaseInsensitive));
-            });
-
-            if (res != m_inputList.end()) {
-                value = (*res).chiese;
-            }
-
-    return value;
-}
-
 void SearchModel::appendChineseData(SearchBoxStruct::Ptr data)
 {
     auto icon = m_iconMap.find(data->fullPagePath.section('/', 1, 1));
@@ -402,87 +418,20 @@ void SearchModel::appendChineseData(SearchBoxStruct::Ptr data)
         return;
     }
 
-    // 其他函数存在修改智能指针的数值，复制一份解决。
-    SearchBoxStruct::Ptr dataBackup(new SearchBoxStruct(*data));
-
-    if ("" == dataBackup->childPageName) {
-        //先添加使用appenRow添加Qt::EditRole数据(用于下拉框显示),然后添加Qt::UserRole数据(用于输入框搜索)
-        //Qt::EditRole数据用于显示搜索到的结果(汉字)
-        //Qt::UserRole数据用于输入框输入的数据(拼音/汉字 均可)
-        //即在输入框搜索Qt::UserRole的数据,就会在下拉框显示Qt::EditRole的数据
-        appendRow(new QStandardItem(icon.value(),
-                                    getNormalText(QString("%1 --> %2").arg(dataBackup->actualModuleName).arg(dataBackup->translateContent))));
-
-        //设置汉字的Qt::UserRole数据
-        setData(index(rowCount() - 1, 0),
-                         QString("%1 --> %2")
-                         .arg(dataBackup->actualModuleName)
-                         .arg(dataBackup->translateContent),
-                         Qt::UserRole);
-        setData(index(rowCount() - 1, 0), icon->name(), Qt::UserRole + 1);
-
-        QString hanziTxt = QString("%1 --> %2").arg(dataBackup->actualModuleName).arg(dataBackup->translateContent);
-
-        QString pinyinTxt = QString("%1 --> %2")
-                            .arg(removeDigital(DTK_CORE_NAMESPACE::Chinese2Pinyin(dataBackup->actualModuleName.remove(QRegularExpression(R"([a-zA-Z]+)")))))
-                            .arg(removeDigital(DTK_CORE_NAMESPACE::Chinese2Pinyin(dataBackup->translateContent.remove(QRegularExpression(R"([a-zA-Z]+)")))));
-
-        // 如果模块名称中英文相同则不继续添加拼音搜索显示,否则会重复索引
-        // guoyao：针对Union ID（中文环境使用英文模块名），dataBackup->actualModuleName将被过滤为空，所以会return掉；但是data数据并不会更改，所以用data数据进行判断即可
-        if (data->actualModuleName == DTK_CORE_NAMESPACE::Chinese2Pinyin(dataBackup->actualModuleName)) return;
-
-        //添加显示的汉字(用于拼音搜索显示)
-        appendRow(new QStandardItem(icon.value(), getNormalText(hanziTxt)));
-        //设置Qt::UserRole搜索的拼音(即搜索拼音会显示上面的汉字)
-        setData(index(rowCount() - 1, 0), pinyinTxt, Qt::UserRole);
-        setData(index(rowCount() - 1, 0), icon->name(), Qt::UserRole + 1);
-        SearchDataStruct transdata;
-        transdata.chiese = hanziTxt;
-        transdata.pinyin = pinyinTxt;
-        //存储 汉字和拼音 : 在选择对应的下拉框数据后,会将Qt::UserRole数据设置到输入框(即pinyin)
-        //而在输入框发送 DSearchEdit::textChanged 信号时,会遍历m_inputList,根据pinyin获取到对应汉字,再将汉字设置到输入框
-        m_inputList.append(transdata);
+    QString hanziTxt;
+    if ("" == data->childPageName) {
+        hanziTxt = QString("%1 --> %2").arg(data->actualModuleName).arg(data->translateContent);
     } else {
-        //先添加使用appenRow添加Qt::EditRole数据(用于下拉框显示),然后添加Qt::UserRole数据(用于输入框搜索)
-        //Qt::EditRole数据用于显示搜索到的结果(汉字)
-        //Qt::UserRole数据用于输入框输入的数据(拼音/汉字 均可)
-        //即在输入框搜索Qt::UserRole的数据,就会在下拉框显示Qt::EditRole的数据
-        appendRow(new QStandardItem(icon.value(),
-                                    getNormalText(QString("%1 --> %2 / %3")
-                                                  .arg(dataBackup->actualModuleName)
-                                                  .arg(dataBackup->childPageName)
-                                                  .arg(dataBackup->translateContent))));
-
-        //设置汉字的Qt::UserRole数据
-        setData(index(rowCount() - 1, 0),
-                         QString("%1 --> %2 / %3")
-                         .arg(dataBackup->actualModuleName)
-                         .arg(dataBackup->childPageName)
-                         .arg(dataBackup->translateContent),
-                         Qt::UserRole);
-        setData(index(rowCount() - 1, 0), icon->name(), Qt::UserRole + 1);
-
-        QString hanziTxt = QString("%1 --> %2 / %3").arg(dataBackup->actualModuleName).arg(dataBackup->childPageName).arg(dataBackup->translateContent);
-        QString pinyinTxt = QString("%1 --> %2 / %3")
-                            .arg(removeDigital(DTK_CORE_NAMESPACE::Chinese2Pinyin(dataBackup->actualModuleName.remove(QRegularExpression(R"([a-zA-Z]+)")))))
-                            .arg(removeDigital(DTK_CORE_NAMESPACE::Chinese2Pinyin(dataBackup->childPageName.remove(QRegularExpression(R"([a-zA-Z]+)")))))
-                            .arg(removeDigital(DTK_CORE_NAMESPACE::Chinese2Pinyin(dataBackup->translateContent.remove(QRegularExpression(R"([a-zA-Z]+)")))));
-        //添加显示的汉字(用于拼音搜索显示)
-        auto icons = m_iconMap.find(dataBackup->fullPagePath.section('/', 1, 1));
-        if (icons == m_iconMap.end()) {
-            return;
-        }
-        appendRow(new QStandardItem(icons.value(), getNormalText(hanziTxt)));
-        //设置Qt::UserRole搜索的拼音(即搜索拼音会显示上面的汉字)
-        setData(index(rowCount() - 1, 0), pinyinTxt, Qt::UserRole);
-        setData(index(rowCount() - 1, 0), icons->name(), Qt::UserRole + 1);
-        SearchDataStruct transdata;
-        transdata.chiese = hanziTxt;
-        transdata.pinyin = pinyinTxt;
-        //存储 汉字和拼音 : 在选择对应的下拉框数据后,会将Qt::UserRole数据设置到输入框(即pinyin)
-        //而在输入框发送 DSearchEdit::textChanged 信号时,会遍历m_inputList,根据pinyin获取到对应汉字,再将汉字设置到输入框
-        m_inputList.append(transdata);
+        hanziTxt = QString("%1 --> %2 / %3").arg(data->actualModuleName).arg(data->childPageName).arg(data->translateContent);
     }
+
+    //Qt::EditRole数据用于下拉框显示(过长时会被省略),Qt::UserRole数据为完整的汉字,用于补全到输入框
+    //拼音及拼音首字母不再额外添加一行,由 m_engine 对同一行建立索引
+    appendRow(new QStandardItem(icon.value(), getNormalText(hanziTxt)));
+    setData(index(rowCount() - 1, 0), hanziTxt, Qt::UserRole);
+    setData(index(rowCount() - 1, 0), icon->name(), Qt::UserRole + 1);
+    m_engine->addEntry(rowCount() - 1, hanziTxt, true);
+    m_rowTexts.append(hanziTxt);
 }
 
 //主要用于解决一些特殊数据，比如同时加载了二级和三级页面搜索数据，而要删除二级页面数据； true : 不加载
@@ -535,6 +484,7 @@ void SearchModel::setLanguage(const QString &type)
         watcher->deleteLater();
         loadxml();
         m_dataUpdateCompleted = true;
+        m_pendingJumps.setReady(SearchDataReady);
 
     });
 
@@ -554,114 +504,58 @@ void SearchModel::setLanguage(const QString &type)
 #endif
         for (const QString &i : m_xmlFilePath) {
             QString xmlPath = i.arg(m_lang);
-            QFile   file(xmlPath);
-
-            if (!file.exists()) {
-                qDebug() << " [SearchWidget] File not exist:" << xmlPath;
+            SearchIndexData data;
+            if (!SearchIndex::load(xmlPath, data))
                 continue;
-            }
 
-            if (!file.open(QIODevice::ReadOnly | QIODevice::Text)) {
-                qDebug() << " [SearchWidget] File open failed:" << xmlPath;
-                continue;
+            for (const QString &child : data.childPages) {
+                QString childPage = m_transChildPageName.value(child);
+                if (childPage == "") {
+                    childPage = child;
+                    qWarning() << " [SearchWidget]  child page can't translate. childPage : " << childPage;
+                }
+                if (!m_childWidgetList.contains(childPage))
+                    m_childWidgetList.append(childPage);
             }
 
-            QXmlStreamReader            xmlRead(&file);
-            QStringRef                  dataName;
-            SearchBoxStruct::Ptr searchBoxStrcut = std::make_shared<SearchBoxStruct>();
-            QString xmlExplain;
-
-            //遍历XML文件,读取每一行的xml数据都会
-            //先进入StartElement读取出<>中的内容;
-            //再进入Characters读取出中间数据部分;
-            //最后进入时进入EndElement读取出</>中的内容
-            QString strSource = "";
-            while (!xmlRead.atEnd()) {
-                switch (xmlRead.readNext()) {
-                    case QXmlStreamReader::StartElement:
-#if DEBUG_XML_SWITCH
-                        qDebug() << " [SearchWidget] +::StartElement: " << xmlRead.name() << xmlRead.text();
-#endif
-                        xmlExplain = xmlRead.name().toString();
-                        break;
-                    case QXmlStreamReader::Characters:
-                        if (!xmlRead.isWhitespace()) {
-#if DEBUG_XML_SWITCH
-                            qDebug() << " [SearchWidget]  xmlRead.text : " << xmlRead.text().toString();
-#endif
-                            if (xmlExplain == XML_Source) {  // get xml source date
-                                searchBoxStrcut->translateContent = xmlRead.text().toString().remove('/').trimmed();
-                                searchBoxStrcut->source = xmlRead.text().toString();
-                                strSource = xmlRead.text().toString();
-                            }
-                            else if (xmlExplain == XML_Title) {
-                                if (xmlRead.text().toString() != "")  // translation not nullptr can set it
-                                    searchBoxStrcut->translateContent = xmlRead.text().toString().remove('/').trimmed();
-#if DEBUG_XML_SWITCH
-                                qDebug() << " [SearchWidget] searchBoxStrcut->translateContent : " << searchBoxStrcut->translateContent;
-#endif
-                            }
-                            else if (xmlExplain == XML_Numerusform) {
-                                if (xmlRead.text().toString() != "")  // translation not nullptr can set it
-                                    searchBoxStrcut->translateContent = xmlRead.text().toString().remove('/').trimmed();
-                            }
-                            else if (XML_Child_Path == xmlExplain) {
-                                QString childPage = m_transChildPageName.value(xmlRead.text().toString());
-                                if (childPage == "") {
-                                    childPage = xmlRead.text().toString();
-                                    qWarning() << " [SearchWidget]  child page can't translate. childPage : " << childPage;
-                                }
-                                searchBoxStrcut->childPageName = childPage;
-                                if (!m_childWidgetList.contains(childPage))
-                                    m_childWidgetList.append(childPage);
-                            }
-                            else if (XML_ChildHide_Path == xmlExplain) {
-                                //添加二级页面和三级页面都要进入的搜索数据，类似 ： "默认程序 -> 网页 / 添加默认程序" 和 "默认程序 -> 网页"
-                                //以上两种数据都需要搜索，因此需要保存一个特殊的子页面list
-                                QString hideChildPage = m_transChildPageName.value(xmlRead.text().toString());
-                                if (!m_childeHideWidgetList.contains(hideChildPage)) {
-                                    m_childeHideWidgetList.append(hideChildPage);
-                                }
-                            }
-                            else if (xmlExplain == XML_Explain_Path) {
-                                searchBoxStrcut->fullPagePath = xmlRead.text().toString();
-                                // follow path module name to get actual module name  ->  Left module dispaly can support
-                                // mulLanguages
-                                searchBoxStrcut->actualModuleName = getModulesName(searchBoxStrcut->fullPagePath.section('/', 1, 1));
-
-                                if ("" == searchBoxStrcut->actualModuleName || "" == searchBoxStrcut->translateContent) {
-                                    searchBoxStrcut = std::make_shared<SearchBoxStruct>();
-                                    continue;
-                                }
-
-                                //判断是否非社区版，如果是非社区版本，屏蔽镜像源列表
-                                if (!IsCommunitySystem) {
-                                    if("Smart Mirror Switch" == strSource
-                                            || "Switch it on to connect to the quickest mirror site automatically" == strSource
-                                            || "System Repository Detection" == strSource
-                                            || "Mirror List" == strSource) {
-                                        searchBoxStrcut = std::make_shared<SearchBoxStruct>();
-                                        continue;
-                                    }
-                                }
-
-                                list << searchBoxStrcut;
-                                searchBoxStrcut = std::make_shared<SearchBoxStruct>();
-                            }
-                        }
-                        break;
-                    case QXmlStreamReader::EndElement:
-#if DEBUG_XML_SWITCH
-                        qDebug() << " [SearchWidget] -::EndElement: " << xmlRead.name();
-#endif
-                        break;
-                    default: break;
+            //添加二级页面和三级页面都要进入的搜索数据，类似 ： "默认程序 -> 网页 / 添加默认程序" 和 "默认程序 -> 网页"
+            //以上两种数据都需要搜索，因此需要保存一个特殊的子页面list
+            for (const QString &hideChild : data.hideChildPages) {
+                QString hideChildPage = m_transChildPageName.value(hideChild);
+                if (!m_childeHideWidgetList.contains(hideChildPage)) {
+                    m_childeHideWidgetList.append(hideChildPage);
                 }
             }
 
-            qDebug() << " [SearchWidget] m_EnterNewPagelist.count : " << m_EnterNewPagelist.count();
+            for (const SearchIndexEntry &entry : data.entries) {
+                SearchBoxStruct::Ptr searchBoxStrcut = std::make_shared<SearchBoxStruct>();
+                searchBoxStrcut->source = entry.source;
+                searchBoxStrcut->translateContent = entry.translateContent;
+                if (!entry.childPage.isEmpty()) {
+                    const QString &childPage = m_transChildPageName.value(entry.childPage);
+                    searchBoxStrcut->childPageName = childPage.isEmpty() ? entry.childPage : childPage;
+                }
+                searchBoxStrcut->fullPagePath = entry.fullPagePath;
+                // follow path module name to get actual module name  ->  Left module dispaly can support
+                // mulLanguages
+                searchBoxStrcut->actualModuleName = getModulesName(searchBoxStrcut->fullPagePath.section('/', 1, 1));
+
+                if ("" == searchBoxStrcut->actualModuleName || "" == searchBoxStrcut->translateContent) {
+                    continue;
+                }
+
+                //判断是否非社区版，如果是非社区版本，屏蔽镜像源列表
+                if (!IsCommunitySystem) {
+                    if("Smart Mirror Switch" == entry.source
+                            || "Switch it on to connect to the quickest mirror site automatically" == entry.source
+                            || "System Repository Detection" == entry.source
+                            || "Mirror List" == entry.source) {
+                        continue;
+                    }
+                }
 
-            file.close();
+                list << searchBoxStrcut;
+            }
         }
 
         return list;
@@ -696,7 +590,7 @@ bool SearchModel::getModuleVisible(const QString module)
         return false;
     }
 
-    return m_hideModuleList.value(module);
+    return m_visibleModules.contains(module);
 }
 
 //获取模块内子页面是否显示
@@ -706,17 +600,11 @@ bool SearchModel::getWidgetVisible(const QString module, QString widget)
         return false;
     }
 
-    HideChildWidgetStruct value;
-    auto findModule = std::find_if(m_hideWidgetList.begin(), m_hideWidgetList.end(), [&module](const HideChildWidgetStruct& item) {
-        return (item.module == module);
-    });
-
-    if (findModule != m_hideWidgetList.end()) {
-        value = (*findModule);
-        return value.childWidgetMap.value(widget);
+    if (m_deferredModules.contains(module)) {
+        return true;
     }
 
-    return false;
+    return m_visibleWidgets.contains(SearchWidgetKey(module, widget));
 }
 
 //获取模块内子页面的搜索数据是否显示
@@ -726,27 +614,27 @@ bool SearchModel::getDetailVisible(const QString module, QString widget, QString
         return false;
     }
 
-    HideChildWidgetDetailStruct value;
-    auto findWidget = std::find_if(m_hideWidgetDetailList.begin(), m_hideWidgetDetailList.end(), [&module, &widget](const HideChildWidgetDetailStruct& item) {
-        return (item.module == module && item.childWidget == widget);
-    });
-
-    if (findWidget != m_hideWidgetDetailList.end()) {
-        value = (*findWidget);
-        return value.detailMap.value(detail);
+    if (m_deferredModules.contains(module)) {
+        return true;
     }
 
-    return false;
+    return m_visibleDetails.contains(SearchDetailKey(SearchWidgetKey(module, widget), detail));
 }
 
 //设置模块是否显示
 void SearchModel::setModuleVisible(const QString &module, bool visible)
 {
-    if (module == "" || m_hideModuleList.value(module) == visible) {
+    if (module == "" || m_visibleModules.contains(module) == visible) {
         return;
     }
 
-    m_hideModuleList.insert(module, visible);
+    if (visible) {
+        m_visibleModules.insert(module);
+    } else {
+        m_visibleModules.remove(module);
+    }
+
+    updateEntriesVisible(m_moduleEntries.values(module));
 }
 
 //设置模块内子页面是否显示
@@ -756,72 +644,60 @@ void SearchModel::setWidgetVisible(const QString &module, const QString &widget,
         return;
     }
 
-    for (auto &data : m_hideWidgetList) {
-        if (data.module == module && data.childWidgetMap.contains(widget)) {
-            data.childWidgetMap.insert(widget, visible);
-            return;
-        }
+    const SearchWidgetKey key(module, widget);
+    if (m_visibleWidgets.contains(key) == visible) {
+        return;
     }
 
-    //以下为第一次新增数据
-    HideChildWidgetStruct value;
-    value.module = module;
-    value.childWidgetMap.insert(widget, visible);
-
-    int count = m_hideWidgetList.count();
-    if (count == 0) {
-        m_hideWidgetList.append(value);
+    if (visible) {
+        m_visibleWidgets.insert(key);
     } else {
-        for (int i = 0; i < count; i++) {
-            if (m_hideWidgetList[i].module == module) {
-                m_hideWidgetList[i].childWidgetMap.insert(widget, visible);
-                return;
-            }
-            if (i == count - 1) {
-                m_hideWidgetList.append(value);
-            }
-        }
+        m_visibleWidgets.remove(key);
     }
+
+    updateEntriesVisible(m_widgetEntries.values(key));
 }
 
 //设置模块内子页面的详细搜索数据是否显示
 void SearchModel::setDetailVisible(const QString &module, const QString &widget, const QString &detail, bool visible)
 {
-    for (auto &data : m_hideWidgetDetailList) {
-        if (data.module == module && data.childWidget == widget && data.detailMap.contains(detail)) {
-            data.detailMap.insert(detail, visible);
-            return;
-        }
+    const SearchDetailKey key(SearchWidgetKey(module, widget), detail);
+    if (m_visibleDetails.contains(key) == visible) {
+        return;
     }
 
-    //以下为第一次新增数据
-    HideChildWidgetDetailStruct value;
-    value.module = module;
-    value.childWidget = widget;
-    value.detailMap.insert(detail, visible);
+    if (visible) {
+        m_visibleDetails.insert(key);
+    } else {
+        m_visibleDetails.remove(key);
+    }
+
+    updateEntriesVisible(m_detailEntries.values(key));
+}
 
-    int count = m_hideWidgetDetailList.count();
-    if (count == 0) {
-        m_hideWidgetDetailList.append(value);
+//设置模块是否延迟预初始化，延迟期间模块还未设置子页面及详细数据的可见性，默认全部显示
+void SearchModel::setModuleDeferred(const QString &module, bool deferred)
+{
+    if (module == "" || m_deferredModules.contains(module) == deferred) {
+        return;
+    }
+
+    if (deferred) {
+        m_deferredModules.insert(module);
     } else {
-        for (int i = 0; i < count; i++) {
-            if (m_hideWidgetDetailList[i].module == module && m_hideWidgetDetailList[i].childWidget == widget) {
-                m_hideWidgetDetailList[i].detailMap.insert(detail, visible);
-                return;
-            }
-            if (i == count -1) {
-                m_hideWidgetDetailList.append(value);
-            }
-        }
+        m_deferredModules.remove(module);
     }
+
+    updateEntriesVisible(m_moduleEntries.values(module));
 }
 
+//可见性变化已增量生效，只有字体大小变化(显示文本需要重新省略)时才重建
 void SearchModel::updateSearchData(const QString &module, int fontSize)
 {
     qDebug() << "updateSearchData:" << module << fontSize;
-    if (fontSize > 0) {
+    if (fontSize > 0 && fontSize != m_fontSize) {
         m_fontSize = fontSize;
-        loadxml(module);
+        loadxml();
     }
 }
 
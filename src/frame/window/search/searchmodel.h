@@ -5,6 +5,8 @@
 #pragma once
 
 #include "interface/namespace.h"
+#include "searchengine.h"
+#include "window/navigationqueue.h"
 
 #include <QStandardItemModel>
 #include <QSet>
@@ -24,21 +26,8 @@ struct SearchBoxStruct {
     QString fullPagePath;
 };
 
-struct SearchDataStruct {
-    QString chiese;
-    QString pinyin;
-};
-
-struct HideChildWidgetStruct {
-    QString module;                                     //子页面的模块
-    QMap<QString, bool> childWidgetMap;              //子页面名称, 子页面是否显示
-};
-
-struct HideChildWidgetDetailStruct {
-    QString module;                                     //子页面的模块，避免重复子页面名称
-    QString childWidget;                                //子页面名称
-    QMap<QString, bool> detailMap;                     //详细搜索数据是否显示
-};
+typedef QPair<QString, QString> SearchWidgetKey;              //模块, 子页面
+typedef QPair<SearchWidgetKey, QString> SearchDetailKey;      //模块, 子页面, 详细搜索数据
 
 
 class SearchModel : public QStandardItemModel {
@@ -59,21 +48,30 @@ public:
     void setModuleVisible(const QString &module, bool visible);
     void setWidgetVisible(const QString &module, const QString &widget, bool visible);
     void setDetailVisible(const QString &module, const QString &widget, const QString &detail, bool visible);
+    void setModuleDeferred(const QString &module, bool deferred);
     void updateSearchData(const QString &module, int fontSize);
     void getJumpPath(QString &moduleName, QString &pageName, const QString &searchName);
     inline bool getDataUpdateCompleted() { return m_dataUpdateCompleted; }
     void addChildPageTrans(const QString &menu, const QString &tran);
     QString getRealTxt(const QString &key) const;
+    // 返回匹配 text 且当前可见的行，按匹配程度排序
+    QList<int> search(const QString &text, int maxResults = -1) const;
+    // 当前搜索数据及可见性的只读快照，用于在其他线程中查询
+    SearchSnapshot::Ptr snapshot() const;
 
 Q_SIGNALS:
     void notifyModuleSearch(QString, QString);
+    void searchDataUpdated();
+    void searchVisibilityChanged();
 
 private:
-    void loadxml(const QString module = "");
+    void loadxml();
+    bool isPluginEntry(SearchBoxStruct::Ptr data) const;
+    QString entryWidget(SearchBoxStruct::Ptr data, bool *twoLevel = nullptr) const;
+    bool isEntryVisible(SearchBoxStruct::Ptr data);
+    void indexEntry(int id);
+    void updateEntriesVisible(const QList<int> &entries);
     QString getModulesName(const QString &name, bool state = true);
-    QString removeDigital(QString input);
-    QString transPinyinToChinese(const QString &pinyin);
-    QString containTxtData(QString txt);
     void appendChineseData(SearchBoxStruct::Ptr data);
     SearchBoxStruct::Ptr getModuleBtnString(QString value);
     bool specialProcessData(SearchBoxStruct::Ptr data);
@@ -87,18 +85,27 @@ private:
     QString m_lang;
     QMap<QString, QIcon> m_iconMap;
     QList<QPair<QString, QString>> m_moduleNameList;//用于存储如 "update"和"Update"
-    QList<SearchDataStruct> m_inputList;
+    std::shared_ptr<SearchEngine> m_engine;             //搜索数据的拼音及 n-gram 索引，行号对应本模型，loadxml 时重新创建
+    QStringList m_rowTexts;                             //模型行 -> 完整(未省略)的搜索结果文本
     QList<QString> m_childWidgetList; //二级页面list
     QList<QString> m_childeHideWidgetList; //不需要显示的二级页面list，比如 “默认程序 --> 终端 / 添加默认程序” 和 “默认程序 --> 终端”
-    QList<QString> m_TxtListAll; //三级页面list
+    QHash<QString, int> m_visibleTxtCount; //可见搜索数据的文本及其数量
     QList<QPair<QString, QString>> m_removeableActualExistList;//存储实际模块是否存在
     bool m_bIsChinese;
     bool m_bIstextEdited;
-    QMap<QString, bool> m_hideModuleList;
-    QList<HideChildWidgetStruct> m_hideWidgetList;
-    QList<HideChildWidgetDetailStruct> m_hideWidgetDetailList;
+    QSet<QString> m_visibleModules;                     //设置为显示的模块
+    QSet<SearchWidgetKey> m_visibleWidgets;             //设置为显示的子页面
+    QSet<SearchDetailKey> m_visibleDetails;             //设置为显示的详细搜索数据
+    //以下为 m_EnterNewPagelist 的附加数据，loadxml 时建立，可见性变化时只更新受影响的条目
+    QVector<bool> m_entryVisible;                       //条目是否可见
+    QVector<int> m_rowEntries;                          //模型行 -> 条目
+    QMultiHash<QString, int> m_moduleEntries;           //模块 -> 条目
+    QMultiHash<SearchWidgetKey, int> m_widgetEntries;   //子页面 -> 条目
+    QMultiHash<SearchDetailKey, int> m_detailEntries;   //详细搜索数据 -> 条目
+    QSet<QString> m_deferredModules;                    //尚未预初始化的模块，其搜索数据默认显示
     QMap<QString, QString> m_transChildPageName;
     bool m_dataUpdateCompleted;
+    NavigationQueue m_pendingJumps;                     //搜索数据加载完成前收到的跳转请求
     QMap<QString, QString> m_transPlusData;
     QLabel *m_calLenthLabel;
     QMap<QString, QString> m_scaleTxtMap;
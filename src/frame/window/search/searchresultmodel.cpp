@@ -0,0 +1,77 @@
+// SPDX-FileCopyrightText: 2022 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include "searchresultmodel.h"
+#include "searchmodel.h"
+
+#include <QSet>
+
+using namespace DCC_NAMESPACE::search;
+
+SearchResultModel::SearchResultModel(SearchModel *source, QObject *parent)
+    : QAbstractListModel(parent)
+    , m_source(source)
+{
+    // 搜索数据重建后重新匹配当前输入
+    connect(m_source, &SearchModel::modelReset, this, &SearchResultModel::refresh);
+    connect(m_source, &SearchModel::searchDataUpdated, this, &SearchResultModel::refresh);
+    connect(m_source, &SearchModel::searchVisibilityChanged, this, &SearchResultModel::updateVisibleRows);
+}
+
+void SearchResultModel::setFilter(const QString &text)
+{
+    if (m_filter == text)
+        return;
+
+    m_filter = text;
+    refresh();
+}
+
+int SearchResultModel::rowCount(const QModelIndex &parent) const
+{
+    return parent.isValid() ? 0 : m_rows.size();
+}
+
+QVariant SearchResultModel::data(const QModelIndex &index, int role) const
+{
+    if (!index.isValid() || index.row() >= m_rows.size())
+        return QVariant();
+
+    return m_source->data(m_source->index(m_rows.at(index.row()), 0), role);
+}
+
+void SearchResultModel::refresh()
+{
+    beginResetModel();
+    m_rows = m_source->search(m_filter);
+    endResetModel();
+}
+
+// 可见性变化只移除/插入变化的行，不重置整个列表
+void SearchResultModel::updateVisibleRows()
+{
+    if (m_filter.isEmpty())
+        return;
+
+    const QList<int> &rows = m_source->search(m_filter);
+    const QSet<int> visibleRows(rows.begin(), rows.end());
+    for (int i = m_rows.size() - 1; i >= 0; --i) {
+        if (visibleRows.contains(m_rows.at(i)))
+            continue;
+
+        beginRemoveRows(QModelIndex(), i, i);
+        m_rows.removeAt(i);
+        endRemoveRows();
+    }
+
+    // 结果排序固定，剩余的行是新结果的子序列，按顺序补上新显示的行
+    for (int i = 0; i < rows.size(); ++i) {
+        if (i < m_rows.size() && m_rows.at(i) == rows.at(i))
+            continue;
+
+        beginInsertRows(QModelIndex(), i, i);
+        m_rows.insert(i, rows.at(i));
+        endInsertRows();
+    }
+}
@@ -0,0 +1,39 @@
+// SPDX-FileCopyrightText: 2022 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#pragma once
+
+#include "interface/namespace.h"
+
+#include <QAbstractListModel>
+
+namespace DCC_NAMESPACE {
+namespace search {
+class SearchModel;
+
+// 补全列表使用的模型，只包含 SearchModel 中匹配当前输入的行
+// 匹配由 SearchModel 的倒排索引完成，QCompleter 以 UnfilteredPopupCompletion 方式直接显示结果
+class SearchResultModel : public QAbstractListModel
+{
+    Q_OBJECT
+public:
+    explicit SearchResultModel(SearchModel *source, QObject *parent = nullptr);
+
+    void setFilter(const QString &text);
+
+    int rowCount(const QModelIndex &parent = QModelIndex()) const override;
+    QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const override;
+
+private:
+    void refresh();
+    void updateVisibleRows();
+
+private:
+    SearchModel *m_source;
+    QString m_filter;
+    QList<int> m_rows;  // 当前结果在 SearchModel 中的行号
+};
+
+}// namespace search
+}// namespace DCC_NAMESPACE
@@ -4,6 +4,8 @@
 
 #include "searchwidget.h"
 #include "searchmodel.h"
+#include "searchresultmodel.h"
+#include "grandsearchquery.h"
 #include "window/gsettingwatcher.h"
 #include "interface/moduleinterface.h"
 
@@ -71,12 +73,14 @@ SearchWidget::SearchWidget(QWidget *parent)
     : DTK_WIDGET_NAMESPACE::DSearchEdit(parent)
 {
     m_model = new SearchModel(this);
-    m_completer = new ddeCompleter(m_model, this);
+    m_resultModel = new SearchResultModel(m_model, this);
+    m_grandSearchQuery = new GrandSearchQuery(this);
+    m_completer = new ddeCompleter(m_resultModel, this);
     m_completer->popup()->setItemDelegate(&styledItemDelegate);
     m_completer->popup()->setAttribute(Qt::WA_InputMethodEnabled);
 
-    m_completer->setFilterMode(Qt::MatchContains);//设置QCompleter支持匹配字符搜索
-    m_completer->setCaseSensitivity(Qt::CaseInsensitive);//这个属性可设置进行匹配时的大小写敏感性
+    //匹配(包含、忽略大小写、拼音及拼音首字母)由 m_resultModel 完成，QCompleter 直接显示匹配结果
+    m_completer->setCompletionMode(QCompleter::UnfilteredPopupCompletion);
     m_completer->setCompletionRole(Qt::UserRole); //设置ItemDataRole
     m_completer->setWrapAround(false);
     m_completer->installEventFilter(this);
@@ -86,6 +90,13 @@ SearchWidget::SearchWidget(QWidget *parent)
 
     connect(m_model, &SearchModel::notifyModuleSearch, this, &SearchWidget::notifyModuleSearch);
 
+    //搜索数据或可见性变化后向大搜索发布新的只读快照
+    auto publishSnapshot = [this] {
+        m_grandSearchQuery->setSnapshot(m_model->snapshot());
+    };
+    connect(m_model, &SearchModel::searchDataUpdated, this, publishSnapshot);
+    connect(m_model, &SearchModel::searchVisibilityChanged, this, publishSnapshot);
+
     connect(this, &DTK_WIDGET_NAMESPACE::DSearchEdit::textEdited, this, [ = ] {
         //m_bIstextEdited，　true : 用户输入　，　false : 直接调用setText
         //text(). ""　：　表示使用清除按钮删除数据，发送的信号；　非空　：　表示用户输入数据发送的信号
@@ -107,11 +118,11 @@ SearchWidget::SearchWidget(QWidget *parent)
             if (!jumpContentPathWidget(text())) {
                 //m_completer未关联部件时，currentCompletion只会获取到第一个选项并且不会在Edit中补全内容，需要通过popup()获取当前选择项并手动补全edit内容
                 QString currentCompletion = m_completer->popup()->currentIndex().data().toString();
-                currentCompletion = m_model->getRealTxt(currentCompletion);
-                //如果通过popup()未获取当前选择项,再通过currentCompletion获取第一个选项
-                if (m_completer->completionCount() > 0 && currentCompletion.isEmpty()) {
-                    currentCompletion = m_completer->currentCompletion();
+                //如果通过popup()未获取当前选择项,取匹配结果的第一项；匹配由 m_resultModel 完成，不能再通过 QCompleter 获取
+                if (currentCompletion.isEmpty() && m_resultModel->rowCount() > 0) {
+                    currentCompletion = m_resultModel->index(0, 0).data().toString();
                 }
+                currentCompletion = m_model->getRealTxt(currentCompletion);
                 qDebug() << Q_FUNC_INFO << " [SearchWidget] currentCompletion : " << currentCompletion;
 
                 //若未获取到任何补全项直接退出,以免将已输入内容清空
@@ -119,12 +130,8 @@ SearchWidget::SearchWidget(QWidget *parent)
                     return ;
                 }
 
-                //中文遍历一遍,若没有匹配再遍历将拼音转化为中文再遍历
-                //解决输入拼音时,有配置数据后,直接回车无法进入第一个匹配数据页面的问题
-                if (!jumpContentPathWidget(currentCompletion)) {
-                    currentCompletion = m_model->transPinyinToChinese(currentCompletion);
-                    jumpContentPathWidget(currentCompletion);
-                }
+                //拼音匹配的结果同样以汉字显示，直接跳转
+                jumpContentPathWidget(currentCompletion);
 
                 //根据匹配的信息补全DSearchEdit的内容，block信号避免重新触发自动补全
                 this->blockSignals(true);
@@ -157,6 +164,7 @@ void SearchWidget::onAutoComplete(const QString &text)
     if (widget && text.isEmpty()) {
         widget->hide();
     } else {
+        m_resultModel->setFilter(text);
         m_completer->setCompletionPrefix(text);
         m_completer->complete();
     }
@@ -301,35 +309,24 @@ void SearchWidget::setDetailVisible(const QString &module, const QString &widget
     m_model->setDetailVisible(module, widget, detail, visible);
 }
 
-void SearchWidget::updateSearchdata(const QString &module, int fontSize)
+void SearchWidget::setModuleDeferred(const QString &module, bool deferred)
 {
     if (!m_model) {
         return;
     }
 
-    m_model->updateSearchData(module, fontSize);
+    m_model->setModuleDeferred(module, deferred);
 }
 
-//返回搜索结果
-QList<QString> SearchWidget::searchResults(const QString text)
+void SearchWidget::updateSearchdata(const QString &module, int fontSize)
 {
-    QElapsedTimer et;
-    et.start();
-    while (!m_model->getDataUpdateCompleted() && et.elapsed() < 5000) {
-        QThread::msleep(50);
-        QCoreApplication::processEvents();
-    }
-    QList<QString> lstSearchMsgs;
-    for (int row = 0; row < m_model->rowCount(); row++) {
-        QString msg = m_model->data(m_model->index(row, 0), m_model->m_bIsChinese? Qt::UserRole: Qt::DisplayRole).toString();
-        if(msg.contains(text,Qt::CaseInsensitive))
-            lstSearchMsgs.append(msg);
-    }
-    for (int i = 0; i < lstSearchMsgs.size(); i++) {
-        lstSearchMsgs[i] = m_model->transPinyinToChinese(lstSearchMsgs[i]);
+    if (!m_model) {
+        return;
     }
-    return lstSearchMsgs;
+
+    m_model->updateSearchData(module, fontSize);
 }
+
 void SearchWidget::addChildPageTrans(const QString &menu, const QString &tran)
 {
     if (!m_model) {
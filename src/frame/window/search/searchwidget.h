@@ -22,6 +22,8 @@ QT_END_NAMESPACE
 namespace DCC_NAMESPACE {
 namespace search {
 class SearchModel;
+class SearchResultModel;
+class GrandSearchQuery;
 
 class DCompleterStyledItemDelegate : public QStyledItemDelegate
 {
@@ -42,11 +44,12 @@ public:
     void setLanguage(const QString &type);
     void addModulesName(QString moduleName, const QString &searchName, QIcon icon, QString translation = "");
 
-    QList<QString> searchResults(const QString text);
+    inline GrandSearchQuery *grandSearchQuery() const { return m_grandSearchQuery; }
     void getJumpPath(QString &moduleName, QString &pageName, const QString &searchName);
     void setModuleVisible(const QString &module, bool visible);
     void setWidgetVisible(const QString &module, const QString &widget, bool visible);
     void setDetailVisible(const QString &module, const QString &widget, const QString &detail, bool visible);
+    void setModuleDeferred(const QString &module, bool deferred);
     void updateSearchdata(const QString &module, int size);
     void addChildPageTrans(const QString &menu, const QString &tran);
 
@@ -61,6 +64,8 @@ Q_SIGNALS:
 
 private:
     SearchModel *m_model;
+    SearchResultModel *m_resultModel;
+    GrandSearchQuery *m_grandSearchQuery;
     QCompleter *m_completer;
     DCompleterStyledItemDelegate styledItemDelegate;
     QStringList m_forbidTextList;
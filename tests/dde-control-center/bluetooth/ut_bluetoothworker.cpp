@@ -6,6 +6,7 @@
 #include "../src/frame/modules/bluetooth/bluetoothworker.h"
 
 #include <QSignalSpy>
+#include <QTest>
 
 using namespace dcc::bluetooth;
 
@@ -103,3 +104,21 @@ TEST_F(Tst_BluetoothWorker, emitSignal)
     bluetooth->AdapterRemoved(adapter);
     EXPECT_LT(model->adapters().count(), old);
 }
+
+TEST_F(Tst_BluetoothWorker, prefetch)
+{
+    QObject context;
+    bool finished = false;
+    BluetoothPrefetch data;
+    BluetoothWorker::prefetch(&context, [&](const BluetoothPrefetch &result) {
+        finished = true;
+        data = result;
+    });
+    // 请求都是异步的，返回前不会回调
+    EXPECT_FALSE(finished);
+
+    // 飞行模式在系统总线上，测试环境中不一定可用，只检查蓝牙服务的数据
+    ASSERT_TRUE(QTest::qWaitFor([&finished] { return finished; }));
+    EXPECT_TRUE(data.bluetoothProperties.contains("State"));
+    EXPECT_TRUE(data.bluetoothProperties.contains("DisplaySwitch"));
+}
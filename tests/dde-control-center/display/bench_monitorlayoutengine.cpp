@@ -0,0 +1,110 @@
+// SPDX-FileCopyrightText: 2022 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+// 多屏布局引擎压测：生成 2~16 块屏幕的横排、竖排和网格布局，
+// 模拟拖动其中一块屏幕绕场一周，统计每一步相邻关系、连通性和拼接分析的耗时；
+// 同时用逐对比较的朴素算法校验相邻关系，结果不一致时返回非 0
+
+#include "modules/display/monitorlayoutengine.h"
+
+#include <QElapsedTimer>
+#include <QTextStream>
+#include <QVector>
+
+#include <cmath>
+
+using namespace dcc::display;
+
+static const int ScreenWidth = 192;
+static const int ScreenHeight = 108;
+static const int DragSteps = 200;
+
+static MonitorLayoutEngine::Item makeItem(const QPointF &topLeft)
+{
+    const QRectF bounding(topLeft, QSizeF(ScreenWidth, ScreenHeight));
+    return { bounding, bounding.adjusted(-0.05, -0.05, 0.05, 0.05), bounding.adjusted(1, 1, -1, -1) };
+}
+
+static QVector<MonitorLayoutEngine::Item> makeLayout(const QString &shape, int count)
+{
+    QVector<MonitorLayoutEngine::Item> items;
+    const int columns = shape == "row" ? count : shape == "column" ? 1 : static_cast<int>(std::ceil(std::sqrt(count)));
+    for (int i = 0; i < count; ++i)
+        items.append(makeItem(QPointF((i % columns) * ScreenWidth, (i / columns) * ScreenHeight)));
+
+    return items;
+}
+
+// 与原先逐对比较的判断一致，用于校验
+static QVector<QVector<int>> naiveAdjacency(const MonitorLayoutEngine &engine)
+{
+    QVector<QVector<int>> adjacency(engine.count());
+    for (int i = 0; i < engine.count(); ++i) {
+        for (int j = 0; j < engine.count(); ++j) {
+            if (i != j && engine.item(i).extended.intersects(engine.item(j).bounding)
+                    && !engine.item(i).inner.intersects(engine.item(j).bounding))
+                adjacency[i].append(j);
+        }
+    }
+    return adjacency;
+}
+
+int main(int argc, char **argv)
+{
+    Q_UNUSED(argc)
+    Q_UNUSED(argv)
+
+    QTextStream out(stdout);
+    int mismatches = 0;
+
+    for (const QString &shape : { QString("row"), QString("column"), QString("grid") }) {
+        for (int count = 2; count <= 16; ++count) {
+            MonitorLayoutEngine engine;
+            QVector<MonitorLayoutEngine::Item> items = makeLayout(shape, count);
+            engine.setItems(items);
+
+            QVector<int> others;
+            for (int i = 0; i < count - 1; ++i)
+                others.append(i);
+
+            // 最后一块屏幕沿布局外接矩形绕一圈
+            QRectF bounds;
+            for (const auto &item : items)
+                bounds = bounds.united(item.bounding);
+            const QPointF center = bounds.center();
+            const qreal radius = std::hypot(bounds.width(), bounds.height()) / 2;
+
+            QElapsedTimer timer;
+            qint64 elapsed = 0;
+            int connectedSteps = 0;
+            for (int step = 0; step < DragSteps; ++step) {
+                const qreal angle = 2 * M_PI * step / DragSteps;
+                const QPointF pos = center + QPointF(radius * std::cos(angle), radius * std::sin(angle))
+                        - QPointF(ScreenWidth / 2.0, ScreenHeight / 2.0);
+
+                timer.start();
+                engine.updateItem(count - 1, makeItem(pos));
+                engine.rebuildAdjacency();
+                connectedSteps += engine.isFullyConnected();
+                engine.analyzeMove(count - 1, others);
+                elapsed += timer.nsecsElapsed();
+
+                const QVector<QVector<int>> expected = naiveAdjacency(engine);
+                for (int i = 0; i < count; ++i) {
+                    if (engine.neighbors(i) != expected[i])
+                        ++mismatches;
+                }
+            }
+
+            out << shape << " screens: " << count
+                << " avg(us): " << QString::number(elapsed / 1000.0 / DragSteps, 'f', 2)
+                << " connected steps: " << connectedSteps << "/" << DragSteps << endl;
+        }
+    }
+
+    if (mismatches)
+        out << "adjacency mismatches: " << mismatches << endl;
+
+    return mismatches ? 1 : 0;
+}
@@ -0,0 +1,66 @@
+// SPDX-FileCopyrightText: 2022 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include "display_dbus.h"
+
+#include <QApplication>
+#include <QDebug>
+#include <QProcess>
+
+#include <gtest/gtest.h>
+
+#ifdef QT_DEBUG
+#include <sanitizer/asan_interface.h>
+#endif
+
+int main(int argc, char **argv)
+{
+    QProcess process;
+    QString cmd = "dbus-daemon --session --print-address";
+    process.start(cmd);
+    process.waitForReadyRead();
+
+    QString path = process.readAllStandardOutput().simplified();
+
+    setenv("DBUS_SESSION_BUS_ADDRESS", path.toStdString().data(), 1);
+    setenv("QT_QPA_PLATFORM", "offscreen", 1);
+    qDebug() << getenv("DBUS_SESSION_BUS_ADDRESS");
+
+    QApplication app(argc, argv);
+    registerMonitorModeMetaType();
+
+    QDBusConnection conn = QDBusConnection::sessionBus();
+    bool bOk = conn.registerService(DISPLAY_SERVICE_NAME);
+    if (!bOk) {
+        QDBusError err = conn.lastError();
+        qWarning() << err.name() << ", " << err.message();
+        process.close();
+        return -1;
+    }
+
+    DisplayManager service;
+    service.setPrimary("HDMI-1");
+    DisplayMonitor hdmi("HDMI-1");
+    DisplayMonitor vga("VGA-1");
+    bOk = conn.registerObject(DISPLAY_SERVICE_PATH, &service, QDBusConnection::ExportAllContents)
+          && conn.registerObject(QString(DISPLAY_MONITOR_PATH).arg(1), &hdmi, QDBusConnection::ExportAllContents)
+          && conn.registerObject(QString(DISPLAY_MONITOR_PATH).arg(2), &vga, QDBusConnection::ExportAllContents);
+    if (!bOk) {
+        QDBusError err = conn.lastError();
+        qWarning() << err.name() << ", " << err.message();
+        process.close();
+        return -1;
+    }
+
+    ::testing::InitGoogleTest(&argc, argv);
+
+    int result = RUN_ALL_TESTS();
+
+#ifdef QT_DEBUG
+    __sanitizer_set_report_path("asan_display.log");
+#endif
+
+    process.close();
+    return result;
+}
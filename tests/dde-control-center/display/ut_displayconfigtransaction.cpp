@@ -0,0 +1,203 @@
+// SPDX-FileCopyrightText: 2022 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#define private public
+#include "../src/frame/modules/display/displayworker.h"
+#undef private
+
+#include "../src/frame/modules/display/displayconfigtransaction.h"
+#include "../src/frame/modules/display/displaymodel.h"
+#include "display_dbus.h"
+
+#include <QDBusConnection>
+#include <QSignalSpy>
+#include <QTest>
+
+#include <gtest/gtest.h>
+
+using namespace dcc::display;
+
+class Tst_DisplayConfigTransaction : public testing::Test
+{
+public:
+    void SetUp() override
+    {
+        QDBusConnection conn = QDBusConnection::sessionBus();
+        daemon = qobject_cast<DisplayManager *>(conn.objectRegisteredAt(DISPLAY_SERVICE_PATH));
+        hdmi = qobject_cast<DisplayMonitor *>(conn.objectRegisteredAt(QString(DISPLAY_MONITOR_PATH).arg(1)));
+        vga = qobject_cast<DisplayMonitor *>(conn.objectRegisteredAt(QString(DISPLAY_MONITOR_PATH).arg(2)));
+        ASSERT_TRUE(daemon && hdmi && vga);
+        daemon->reset();
+        hdmi->reset();
+        vga->reset();
+
+        model = new DisplayModel;
+        worker = new DisplayWorker(model);
+        worker->onMonitorListChanged({ QDBusObjectPath(QString(DISPLAY_MONITOR_PATH).arg(1)),
+                                       QDBusObjectPath(QString(DISPLAY_MONITOR_PATH).arg(2)) });
+        ASSERT_TRUE(QTest::qWaitFor([this] { return model->monitorList().size() == 2; }));
+
+        hdmiMonitor = monitor("HDMI-1");
+        vgaMonitor = monitor("VGA-1");
+        ASSERT_TRUE(hdmiMonitor && vgaMonitor);
+    }
+
+    void TearDown() override
+    {
+        delete worker;
+        worker = nullptr;
+        delete model;
+        model = nullptr;
+    }
+
+    Monitor *monitor(const QString &name) const
+    {
+        for (auto mon : model->monitorList()) {
+            if (mon->name() == name)
+                return mon;
+        }
+
+        return nullptr;
+    }
+
+public:
+    DisplayManager *daemon = nullptr;
+    DisplayMonitor *hdmi = nullptr;
+    DisplayMonitor *vga = nullptr;
+    DisplayModel *model = nullptr;
+    DisplayWorker *worker = nullptr;
+    Monitor *hdmiMonitor = nullptr;
+    Monitor *vgaMonitor = nullptr;
+};
+
+TEST_F(Tst_DisplayConfigTransaction, Confirm)
+{
+    DisplayConfigTransaction transaction(model, worker);
+    QSignalSpy awaitingSpy(&transaction, &DisplayConfigTransaction::awaitingConfirmation);
+    QSignalSpy finishedSpy(&transaction, &DisplayConfigTransaction::finished);
+
+    transaction.setResolution(hdmiMonitor, 2);
+    transaction.commit(DisplayConfigTransaction::ApplyNow);
+    EXPECT_EQ(transaction.state(), DisplayConfigTransaction::Applying);
+    EXPECT_EQ(transaction.snapshot().value(hdmiMonitor).mode.id(), 1u);
+
+    ASSERT_TRUE(awaitingSpy.wait());
+    EXPECT_EQ(transaction.state(), DisplayConfigTransaction::AwaitingConfirmation);
+    EXPECT_EQ(hdmi->modeId(), 2u);
+    EXPECT_EQ(daemon->applyCount(), 1);
+
+    const int saveCount = daemon->saveCount();
+    transaction.confirm();
+    EXPECT_EQ(transaction.state(), DisplayConfigTransaction::Confirmed);
+    ASSERT_EQ(finishedSpy.count(), 1);
+    EXPECT_TRUE(finishedSpy.first().first().toBool());
+    EXPECT_EQ(hdmi->modeId(), 2u);
+    EXPECT_EQ(daemon->saveCount(), saveCount + 1);
+}
+
+TEST_F(Tst_DisplayConfigTransaction, Revert)
+{
+    DisplayConfigTransaction transaction(model, worker);
+    QSignalSpy awaitingSpy(&transaction, &DisplayConfigTransaction::awaitingConfirmation);
+    QSignalSpy finishedSpy(&transaction, &DisplayConfigTransaction::finished);
+
+    transaction.setResolution(hdmiMonitor, 2);
+    transaction.commit(DisplayConfigTransaction::ApplyNow);
+    ASSERT_TRUE(awaitingSpy.wait());
+
+    transaction.revert();
+    EXPECT_EQ(transaction.state(), DisplayConfigTransaction::Reverted);
+    ASSERT_EQ(finishedSpy.count(), 1);
+    EXPECT_FALSE(finishedSpy.first().first().toBool());
+    EXPECT_EQ(hdmi->modeId(), 1u);
+    // 还原的分辨率需要再次应用
+    EXPECT_TRUE(QTest::qWaitFor([this] { return daemon->applyCount() == 2; }));
+}
+
+TEST_F(Tst_DisplayConfigTransaction, Timeout)
+{
+    DisplayConfigTransaction transaction(model, worker);
+    QSignalSpy awaitingSpy(&transaction, &DisplayConfigTransaction::awaitingConfirmation);
+    QSignalSpy finishedSpy(&transaction, &DisplayConfigTransaction::finished);
+
+    transaction.setResolution(hdmiMonitor, 3);
+    transaction.commit(DisplayConfigTransaction::ApplyNow, 100);
+    ASSERT_TRUE(awaitingSpy.wait());
+    EXPECT_EQ(hdmi->modeId(), 3u);
+
+    ASSERT_TRUE(finishedSpy.wait());
+    EXPECT_FALSE(finishedSpy.first().first().toBool());
+    EXPECT_EQ(transaction.state(), DisplayConfigTransaction::Reverted);
+    EXPECT_EQ(hdmi->modeId(), 1u);
+
+    // 超时还原后再确认不会生效
+    transaction.confirm();
+    EXPECT_EQ(transaction.state(), DisplayConfigTransaction::Reverted);
+    EXPECT_EQ(finishedSpy.count(), 1);
+}
+
+TEST_F(Tst_DisplayConfigTransaction, MonitorUnplugged)
+{
+    DisplayConfigTransaction transaction(model, worker);
+    QSignalSpy awaitingSpy(&transaction, &DisplayConfigTransaction::awaitingConfirmation);
+    QSignalSpy finishedSpy(&transaction, &DisplayConfigTransaction::finished);
+
+    transaction.setResolution(hdmiMonitor, 2);
+    transaction.setResolution(vgaMonitor, 3);
+    transaction.commit(DisplayConfigTransaction::ApplyNow);
+    ASSERT_TRUE(awaitingSpy.wait());
+    EXPECT_EQ(vga->modeId(), 3u);
+
+    // 等待确认期间拔出屏幕
+    const int vgaSetModeCount = vga->setModeCount();
+    worker->monitorRemoved(QString(DISPLAY_MONITOR_PATH).arg(2));
+    EXPECT_EQ(model->monitorList().size(), 1);
+
+    transaction.revert();
+    ASSERT_EQ(finishedSpy.count(), 1);
+    EXPECT_FALSE(finishedSpy.first().first().toBool());
+    EXPECT_EQ(hdmi->modeId(), 1u);
+    // 被拔出的屏幕不再还原
+    EXPECT_EQ(vga->setModeCount(), vgaSetModeCount);
+    EXPECT_EQ(vga->modeId(), 3u);
+}
+
+TEST_F(Tst_DisplayConfigTransaction, WaitForApply)
+{
+    DisplayConfigTransaction transaction(model, worker);
+    QSignalSpy awaitingSpy(&transaction, &DisplayConfigTransaction::awaitingConfirmation);
+
+    transaction.setResolution(hdmiMonitor, 2);
+    transaction.commit(DisplayConfigTransaction::WaitForApply);
+
+    // 由位置调整触发的 ApplyChanges 完成前不进入等待确认状态
+    QTest::qWait(500);
+    EXPECT_EQ(transaction.state(), DisplayConfigTransaction::Applying);
+    EXPECT_EQ(awaitingSpy.count(), 0);
+    EXPECT_EQ(daemon->applyCount(), 0);
+
+    worker->applyChanges();
+    ASSERT_TRUE(awaitingSpy.wait());
+    EXPECT_EQ(transaction.state(), DisplayConfigTransaction::AwaitingConfirmation);
+    EXPECT_EQ(daemon->applyCount(), 1);
+
+    // 补充调用 ApplyChanges 的定时器不会重复应用
+    QTest::qWait(1000);
+    EXPECT_EQ(daemon->applyCount(), 1);
+    EXPECT_EQ(awaitingSpy.count(), 1);
+}
+
+TEST_F(Tst_DisplayConfigTransaction, WaitForApplyFallback)
+{
+    DisplayConfigTransaction transaction(model, worker);
+    QSignalSpy awaitingSpy(&transaction, &DisplayConfigTransaction::awaitingConfirmation);
+
+    transaction.setResolution(hdmiMonitor, 2);
+    transaction.commit(DisplayConfigTransaction::WaitForApply);
+
+    // 没有其他调用触发 ApplyChanges 时由事务补上
+    ASSERT_TRUE(awaitingSpy.wait(3000));
+    EXPECT_EQ(daemon->applyCount(), 1);
+    EXPECT_EQ(hdmi->modeId(), 2u);
+}
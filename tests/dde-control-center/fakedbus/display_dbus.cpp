@@ -0,0 +1,103 @@
+// SPDX-FileCopyrightText: 2022 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include "display_dbus.h"
+
+#include <QDBusMetaType>
+
+QDBusArgument &operator<<(QDBusArgument &arg, const MonitorMode &mode)
+{
+    arg.beginStructure();
+    arg << mode.id << mode.width << mode.height << mode.rate;
+    arg.endStructure();
+    return arg;
+}
+
+const QDBusArgument &operator>>(const QDBusArgument &arg, MonitorMode &mode)
+{
+    arg.beginStructure();
+    arg >> mode.id >> mode.width >> mode.height >> mode.rate;
+    arg.endStructure();
+    return arg;
+}
+
+void registerMonitorModeMetaType()
+{
+    qRegisterMetaType<MonitorMode>("MonitorMode");
+    qDBusRegisterMetaType<MonitorMode>();
+    qRegisterMetaType<MonitorModeList>("MonitorModeList");
+    qDBusRegisterMetaType<MonitorModeList>();
+}
+
+DisplayManager::DisplayManager(QObject *parent)
+    : QObject(parent)
+{
+}
+
+DisplayManager::~DisplayManager()
+{
+}
+
+void DisplayManager::reset()
+{
+    m_applyCount = 0;
+    m_saveCount = 0;
+}
+
+void DisplayManager::ApplyChanges()
+{
+    ++m_applyCount;
+}
+
+void DisplayManager::Save()
+{
+    ++m_saveCount;
+}
+
+bool DisplayManager::CanSetBrightness(const QString &)
+{
+    return false;
+}
+
+DisplayMonitor::DisplayMonitor(const QString &name, QObject *parent)
+    : QObject(parent)
+    , m_name(name)
+{
+    m_modes << MonitorMode { 1, 1920, 1080, 60.0 }
+            << MonitorMode { 2, 1600, 900, 60.0 }
+            << MonitorMode { 3, 1280, 720, 60.0 };
+}
+
+DisplayMonitor::~DisplayMonitor()
+{
+}
+
+MonitorMode DisplayMonitor::currentMode()
+{
+    for (const auto &mode : m_modes) {
+        if (mode.id == m_modeId)
+            return mode;
+    }
+
+    return m_modes.first();
+}
+
+void DisplayMonitor::reset()
+{
+    m_modeId = 1;
+    m_setModeCount = 0;
+    m_rotation = 1;
+    m_currentFillMode = "None";
+}
+
+void DisplayMonitor::SetMode(uint mode)
+{
+    m_modeId = mode;
+    ++m_setModeCount;
+}
+
+void DisplayMonitor::SetRotation(ushort rotation)
+{
+    m_rotation = rotation;
+}
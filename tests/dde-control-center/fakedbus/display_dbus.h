@@ -0,0 +1,119 @@
+// SPDX-FileCopyrightText: 2022 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#ifndef DISPLAY_DBUS_H
+#define DISPLAY_DBUS_H
+
+#include <QDBusArgument>
+#include <QDBusContext>
+#include <QDBusObjectPath>
+#include <QObject>
+
+#define DISPLAY_SERVICE_NAME "com.deepin.daemon.Display"
+#define DISPLAY_SERVICE_PATH "/com/deepin/daemon/Display"
+#define DISPLAY_MONITOR_INTERFACE "com.deepin.daemon.Display.Monitor"
+#define DISPLAY_MONITOR_PATH "/com/deepin/daemon/Display/Monitor_%1"
+
+// 与后端 Resolution 的 D-Bus 签名 (uqqd) 一致
+struct MonitorMode {
+    uint id;
+    ushort width;
+    ushort height;
+    double rate;
+};
+
+typedef QList<MonitorMode> MonitorModeList;
+
+Q_DECLARE_METATYPE(MonitorMode)
+Q_DECLARE_METATYPE(MonitorModeList)
+
+QDBusArgument &operator<<(QDBusArgument &arg, const MonitorMode &mode);
+const QDBusArgument &operator>>(const QDBusArgument &arg, MonitorMode &mode);
+
+void registerMonitorModeMetaType();
+
+// 记录各个调用，测试中通过 objectRegisteredAt 取得
+class DisplayManager : public QObject
+    , protected QDBusContext
+{
+    Q_OBJECT
+    Q_CLASSINFO("D-Bus Interface", DISPLAY_SERVICE_NAME)
+
+public:
+    DisplayManager(QObject *parent = nullptr);
+    virtual ~DisplayManager();
+
+    Q_PROPERTY(QString Primary READ primary)
+    inline QString primary() { return m_primary; }
+    inline void setPrimary(const QString &primary) { m_primary = primary; }
+
+    inline int applyCount() const { return m_applyCount; }
+    inline int saveCount() const { return m_saveCount; }
+    void reset();
+
+public Q_SLOTS:
+    void ApplyChanges();
+    void Save();
+    bool CanSetBrightness(const QString &name);
+
+private:
+    QString m_primary {QString()};
+    int m_applyCount {0};
+    int m_saveCount {0};
+};
+
+class DisplayMonitor : public QObject
+    , protected QDBusContext
+{
+    Q_OBJECT
+    Q_CLASSINFO("D-Bus Interface", DISPLAY_MONITOR_INTERFACE)
+
+public:
+    DisplayMonitor(const QString &name, QObject *parent = nullptr);
+    virtual ~DisplayMonitor();
+
+    Q_PROPERTY(QString Name READ name)
+    inline QString name() { return m_name; }
+
+    Q_PROPERTY(bool Enabled READ enabled)
+    inline bool enabled() { return true; }
+
+    Q_PROPERTY(MonitorMode CurrentMode READ currentMode)
+    MonitorMode currentMode();
+
+    Q_PROPERTY(MonitorModeList Modes READ modes)
+    inline MonitorModeList modes() { return m_modes; }
+
+    Q_PROPERTY(ushort Width READ width)
+    inline ushort width() { return currentMode().width; }
+
+    Q_PROPERTY(ushort Height READ height)
+    inline ushort height() { return currentMode().height; }
+
+    Q_PROPERTY(ushort Rotation READ rotation)
+    inline ushort rotation() { return m_rotation; }
+
+    Q_PROPERTY(QString CurrentFillMode READ currentFillMode WRITE setCurrentFillMode)
+    inline QString currentFillMode() { return m_currentFillMode; }
+    inline void setCurrentFillMode(const QString &fillMode) { m_currentFillMode = fillMode; }
+
+    inline uint modeId() const { return m_modeId; }
+    // 收到的 SetMode 调用次数
+    inline int setModeCount() const { return m_setModeCount; }
+    void reset();
+
+public Q_SLOTS:
+    void SetMode(uint mode);
+    void SetRotation(ushort rotation);
+
+private:
+    QString m_name;
+    MonitorModeList m_modes;
+    uint m_modeId {1};
+    int m_setModeCount {0};
+    ushort m_rotation {1};
+    QString m_currentFillMode {QString("None")};
+};
+
+#endif
@@ -0,0 +1,49 @@
+// SPDX-FileCopyrightText: 2022 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include "grandsearch_dbus.h"
+#include "window/search/grandsearchquery.h"
+
+using namespace DCC_NAMESPACE::search;
+
+GrandSearchWindow::GrandSearchWindow(GrandSearchQuery *query, QObject *parent)
+    : QObject(parent)
+    , m_query(query)
+{
+}
+
+GrandSearchWindow::~GrandSearchWindow()
+{
+}
+
+QString GrandSearchWindow::GrandSearchSearch(const QString &json)
+{
+    return m_query->search(*this, json);
+}
+
+bool GrandSearchWindow::GrandSearchStop(const QString &json)
+{
+    Q_UNUSED(json)
+    m_query->stop(*this);
+    return true;
+}
+
+GrandSearchAdaptor::GrandSearchAdaptor(GrandSearchWindow *parent)
+    : QDBusAbstractAdaptor(parent)
+{
+}
+
+GrandSearchAdaptor::~GrandSearchAdaptor()
+{
+}
+
+QString GrandSearchAdaptor::Search(const QString json)
+{
+    return static_cast<GrandSearchWindow *>(parent())->GrandSearchSearch(json);
+}
+
+bool GrandSearchAdaptor::Stop(const QString json)
+{
+    return static_cast<GrandSearchWindow *>(parent())->GrandSearchStop(json);
+}
@@ -0,0 +1,55 @@
+// SPDX-FileCopyrightText: 2022 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#ifndef GRANDSEARCH_DBUS_H
+#define GRANDSEARCH_DBUS_H
+
+#include "interface/namespace.h"
+
+#include <QDBusAbstractAdaptor>
+#include <QDBusContext>
+#include <QObject>
+
+#define GRANDSEARCH_SERVICE_PATH "/com/deepin/dde/ControlCenter"
+#define GRANDSEARCH_INTERFACE "com.deepin.dde.ControlCenter.GrandSearch"
+
+namespace DCC_NAMESPACE {
+namespace search {
+class GrandSearchQuery;
+}
+}
+
+// 与 MainWindow 一致：调用上下文由 Qt 设置在适配器的 parent 上，由 parent 转交给 GrandSearchQuery
+class GrandSearchWindow : public QObject
+    , protected QDBusContext
+{
+    Q_OBJECT
+
+public:
+    explicit GrandSearchWindow(DCC_NAMESPACE::search::GrandSearchQuery *query, QObject *parent = nullptr);
+    virtual ~GrandSearchWindow();
+
+    QString GrandSearchSearch(const QString &json);
+    bool GrandSearchStop(const QString &json);
+
+private:
+    DCC_NAMESPACE::search::GrandSearchQuery *m_query;
+};
+
+// 与 DBusControlCenterGrandSearchService 一致，不继承 QDBusContext
+class GrandSearchAdaptor : public QDBusAbstractAdaptor
+{
+    Q_OBJECT
+    Q_CLASSINFO("D-Bus Interface", GRANDSEARCH_INTERFACE)
+
+public:
+    explicit GrandSearchAdaptor(GrandSearchWindow *parent);
+    virtual ~GrandSearchAdaptor();
+
+public Q_SLOTS:
+    QString Search(const QString json);
+    bool Stop(const QString json);
+};
+
+#endif
@@ -68,6 +68,7 @@ TEST_F(Tst_ShortCutSettingWidget, emitSignal)
     widget->onSearchInfo(model->getInfo("<Control><Alt>T"),key);
     widget->showCustomShotcut();
     widget->onResetFinished();
-    EXPECT_NO_THROW(model->setSearchResult(str));
+    model->onParseInfo(str);
+    EXPECT_NO_THROW(model->search("lock"));
 
 }
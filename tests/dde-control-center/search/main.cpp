@@ -0,0 +1,40 @@
+// SPDX-FileCopyrightText: 2022 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include <QApplication>
+#include <QDebug>
+#include <QProcess>
+
+#include <gtest/gtest.h>
+
+#ifdef QT_DEBUG
+#include <sanitizer/asan_interface.h>
+#endif
+
+int main(int argc, char **argv)
+{
+    QProcess process;
+    QString cmd = "dbus-daemon --session --print-address";
+    process.start(cmd);
+    process.waitForReadyRead();
+
+    QString path = process.readAllStandardOutput().simplified();
+
+    setenv("DBUS_SESSION_BUS_ADDRESS", path.toStdString().data(), 1);
+    setenv("QT_QPA_PLATFORM", "offscreen", 1);
+    qDebug() << getenv("DBUS_SESSION_BUS_ADDRESS");
+
+    QApplication app(argc, argv);
+
+    ::testing::InitGoogleTest(&argc, argv);
+
+    int result = RUN_ALL_TESTS();
+
+#ifdef QT_DEBUG
+    __sanitizer_set_report_path("asan_search.log");
+#endif
+
+    process.close();
+    return result;
+}
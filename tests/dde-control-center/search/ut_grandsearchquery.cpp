@@ -0,0 +1,134 @@
+// SPDX-FileCopyrightText: 2022 UnionTech Software Technology Co., Ltd.
+//
+// SPDX-License-Identifier: LGPL-3.0-or-later
+
+#include "grandsearch_dbus.h"
+#include "window/search/grandsearchquery.h"
+
+#include <QDBusConnection>
+#include <QDBusInterface>
+#include <QDBusPendingReply>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QTest>
+
+#include <gtest/gtest.h>
+
+#include <memory>
+
+using namespace DCC_NAMESPACE::search;
+
+class Tst_GrandSearchQuery : public testing::Test
+{
+public:
+    void SetUp() override
+    {
+        query = new GrandSearchQuery;
+        window = new GrandSearchWindow(query);
+        new GrandSearchAdaptor(window);
+        ASSERT_TRUE(QDBusConnection::sessionBus().registerObject(GRANDSEARCH_SERVICE_PATH, window));
+
+        // 每个客户端使用独立的连接，在总线上是不同的调用者
+        clientA = new QDBusConnection(QDBusConnection::connectToBus(QDBusConnection::SessionBus, "grandsearch-client-a"));
+        clientB = new QDBusConnection(QDBusConnection::connectToBus(QDBusConnection::SessionBus, "grandsearch-client-b"));
+        ASSERT_TRUE(clientA->isConnected() && clientB->isConnected());
+    }
+
+    void TearDown() override
+    {
+        QDBusConnection::sessionBus().unregisterObject(GRANDSEARCH_SERVICE_PATH);
+        delete window;
+        window = nullptr;
+        delete query;
+        query = nullptr;
+
+        delete clientA;
+        clientA = nullptr;
+        QDBusConnection::disconnectFromBus("grandsearch-client-a");
+        delete clientB;
+        clientB = nullptr;
+        QDBusConnection::disconnectFromBus("grandsearch-client-b");
+    }
+
+    QDBusPendingCall call(QDBusConnection *client, const QString &method, const QString &text)
+    {
+        QDBusMessage msg = QDBusMessage::createMethodCall(QDBusConnection::sessionBus().baseService(),
+                                                          GRANDSEARCH_SERVICE_PATH, GRANDSEARCH_INTERFACE, method);
+        QJsonObject json;
+        json.insert("cont", text);
+        msg << QString(QJsonDocument(json).toJson(QJsonDocument::Compact));
+        return client->asyncCall(msg);
+    }
+
+    static QStringList items(const QDBusPendingCall &call)
+    {
+        QDBusPendingReply<QString> reply = call;
+        const QJsonObject result = QJsonDocument::fromJson(reply.value().toUtf8()).object();
+        const QJsonArray conts = result.value("cont").toArray();
+
+        QStringList names;
+        for (const QJsonValue &item : conts.first().toObject().value("items").toArray())
+            names << item.toObject().value("name").toString();
+
+        return names;
+    }
+
+    static SearchSnapshot::Ptr snapshot()
+    {
+        auto engine = std::make_shared<SearchEngine>();
+        engine->addEntry(0, "Display", false);
+
+        auto snapshot = std::make_shared<SearchSnapshot>();
+        snapshot->engine = engine;
+        snapshot->rowTexts << "Display";
+        snapshot->rowEntries << 0;
+        snapshot->entryVisible << true;
+        return snapshot;
+    }
+
+public:
+    GrandSearchQuery *query = nullptr;
+    GrandSearchWindow *window = nullptr;
+    QDBusConnection *clientA = nullptr;
+    QDBusConnection *clientB = nullptr;
+};
+
+TEST_F(Tst_GrandSearchQuery, DelayedReply)
+{
+    QDBusPendingCall search = call(clientA, "Search", "Display");
+
+    // 搜索数据未就绪时延迟应答，不会在界面线程中以空结果同步返回
+    QTest::qWait(300);
+    EXPECT_FALSE(search.isFinished());
+
+    query->setSnapshot(snapshot());
+    ASSERT_TRUE(QTest::qWaitFor([&search] { return search.isFinished(); }));
+    EXPECT_FALSE(search.isError());
+    EXPECT_EQ(items(search), QStringList() << "Display");
+}
+
+TEST_F(Tst_GrandSearchQuery, StopPerCaller)
+{
+    QDBusPendingCall searchA = call(clientA, "Search", "Display");
+    QDBusPendingCall searchB = call(clientB, "Search", "Display");
+    QTest::qWait(300);
+    ASSERT_FALSE(searchA.isFinished());
+    ASSERT_FALSE(searchB.isFinished());
+
+    QDBusPendingCall stop = call(clientA, "Stop", QString());
+    ASSERT_TRUE(QTest::qWaitFor([&stop] { return stop.isFinished(); }));
+    EXPECT_FALSE(stop.isError());
+
+    // 只取消发出 Stop 的调用者的查询
+    ASSERT_TRUE(QTest::qWaitFor([&searchA] { return searchA.isFinished(); }));
+    EXPECT_FALSE(searchA.isError());
+    EXPECT_TRUE(items(searchA).isEmpty());
+
+    QTest::qWait(300);
+    EXPECT_FALSE(searchB.isFinished());
+
+    query->setSnapshot(snapshot());
+    ASSERT_TRUE(QTest::qWaitFor([&searchB] { return searchB.isFinished(); }));
+    EXPECT_EQ(items(searchB), QStringList() << "Display");
+}